@@ -1,4 +1,6 @@
+#ifdef _WIN32
 #include <process.h>
+#endif
 
 #include <cpp_redis/cpp_redis>
 
@@ -16,6 +18,7 @@ void ChatServer::OnAccept(const uint64_t sessionID)
     newWork.SessionID = sessionID;
     newWork.WorkType = EWorkType::Accept;
     newWork.Packet = 0;
+    newWork.EnqueueTick = ::timeGetTime();
 
     mWorkQueue.Enqueue(newWork);
     ::SetEvent(mWorkQueueEvent);
@@ -27,17 +30,20 @@ void ChatServer::OnRelease(const uint64_t sessionID)
     newWork.SessionID = sessionID;
     newWork.WorkType = EWorkType::Release;
     newWork.Packet = 0;
+    newWork.EnqueueTick = ::timeGetTime();
 
     mWorkQueue.Enqueue(newWork);
     ::SetEvent(mWorkQueueEvent);
 }
 
-void ChatServer::OnReceive(const uint64_t sessionID, Serializer* packet)
+void ChatServer::OnReceive(const uint64_t sessionID, PacketView& packet)
 {
+    // Ʈ 忡 óϹǷ  ۸  ؼ ѱ
     Work newWork;
     newWork.SessionID = sessionID;
     newWork.WorkType = EWorkType::Receive;
-    newWork.Packet = packet;
+    newWork.Packet = packet.Clone();
+    newWork.EnqueueTick = ::timeGetTime();
 
     mWorkQueue.Enqueue(newWork);
     ::SetEvent(mWorkQueueEvent);
@@ -57,6 +63,16 @@ void ChatServer::Start(const uint16_t port, const uint32_t maxSessionCount, cons
     timerTime.QuadPart = -1 * (10'000 * static_cast<LONGLONG>(mTimeoutCheckInterval));
     ::SetWaitableTimer(mTimeOutCheckEvent, &timerTime, mTimeoutCheckInterval, nullptr, nullptr, FALSE);
 
+    mCurrentTick = ::timeGetTime();
+    mTimeoutTimers.Init(mCurrentTick, TIMEOUT_RESOLUTION_MS);
+
+    ::InitializeSRWLock(&mOverloadLock);
+    mOverloadLevel = EOverloadLevel::Normal;
+    mOverloadLevelEnterTick = mCurrentTick;
+    ::ZeroMemory(mOverloadLevelTime, sizeof(mOverloadLevelTime));
+    mOverloadDroppedChatCount = 0;
+    mOverloadRejectedLoginCount = 0;
+
     mbUpdateThreadRunning = true;
 
     mUpdateThread = (HANDLE)::_beginthreadex(nullptr, 0, updateThread, this, 0, nullptr);
@@ -70,6 +86,7 @@ void ChatServer::Shutdown(void)
 
     for (auto it = mPlayerMap.begin(); it != mPlayerMap.end(); ++it)
     {
+        mTimeoutTimers.Cancel(it->second->GetTimeoutTimer());
         mPlayerPool.Free(it->second);
     }
 
@@ -79,44 +96,119 @@ void ChatServer::Shutdown(void)
     NetServer::Shutdown();
 }
 
-void ChatServer::timeoutCheck(void)
+void ChatServer::resetTimeout(Player* player)
 {
-    uint32_t currentTick = ::timeGetTime();
+    player->UpdateLastRecvTick(mCurrentTick);
 
-    for (auto it = mPlayerMap.begin(); it != mPlayerMap.end(); ++it)
+    uint32_t maxTimeout;
+
+    if (player->IsLoggedIn())
+    {
+        maxTimeout = mTimeoutLoggedIn;
+    }
+    else
     {
-        Player* player = it->second;
-        uint32_t maxTimeout;
+        maxTimeout = mTimeoutNotLoggedIn;
+    }
 
-        if (player->IsLoggedIn())
-        {
-            maxTimeout = mTimeoutLoggedIn;
-        }
-        else
-        {
-            maxTimeout = mTimeoutNotLoggedIn;
-        }
+    if (maxTimeout == 0)
+    {
+        mTimeoutTimers.Cancel(player->GetTimeoutTimer());
+        return;
+    }
 
-        if (maxTimeout == 0)
-        {
-            continue;
-        }
+    mTimeoutTimers.Arm(player->GetTimeoutTimer(), maxTimeout, player->GetSessionID());
+}
+
+void ChatServer::onTimeout(const uint64_t sessionID)
+{
+    Player* player = findPlayerOrNull(sessionID);
+    ASSERT_LIVE(player != nullptr, L"timeouted player is nullptr");
+
+    LOGF(ELogLevel::System, L"SessionID %llu timeouted (loggedIn = %d) (currentTick = %u, player = %u)", sessionID, player->IsLoggedIn(), mCurrentTick, player->GetLastRecvTick());
+    Disconnect(sessionID);
+}
+
+void ChatServer::updateOverloadLevel(const uint32_t workQueueSize, const uint32_t lag, const uint32_t currentTick)
+{
+    const int currentLevel = static_cast<int>(mOverloadLevel);
+
+    int newLevel = static_cast<int>(EOverloadLevel::Normal);
+
+    for (int level = static_cast<int>(EOverloadLevel::Count) - 1; level > 0; --level)
+    {
+        //  ܰ ϴ ͸ũ ݱ Ѵ (迡 ܰ谡   ´)
+        uint32_t divisor = (level <= currentLevel) ? 2 : 1;
+
+        uint32_t workQueueWatermark = mOverloadWorkQueueWatermarks[level];
+        uint32_t lagWatermark = mOverloadLagWatermarks[level];
 
-        if (currentTick - player->GetLastRecvTick() > maxTimeout)
+        if ((workQueueWatermark > 0 && workQueueSize >= workQueueWatermark / divisor) || (lagWatermark > 0 && lag >= lagWatermark / divisor))
         {
-            LOGF(ELogLevel::System, L"SessionID %llu timeouted (maxTimeout = %u) (currentTick = %u, player = %u)", player->GetSessionID(), maxTimeout, currentTick, player->GetLastRecvTick());
-            Disconnect(player->GetSessionID());
+            newLevel = level;
+            break;
         }
     }
+
+    if (newLevel == currentLevel)
+    {
+        return;
+    }
+
+    //    ܰ迡 ּ ӹ ڿ  (ť  á   ܰ谡  ٲ  ´)
+    if (newLevel < currentLevel && currentTick - mOverloadLevelEnterTick < OVERLOAD_LEVEL_HOLD_MS)
+    {
+        return;
+    }
+
+    // GetOverloadLevelTime()     е  ȿ ٲ۴ (ܰ谡 ٲ  ´)
+    ::AcquireSRWLockExclusive(&mOverloadLock);
+
+    mOverloadLevelTime[currentLevel] += currentTick - mOverloadLevelEnterTick;
+    mOverloadLevelEnterTick = currentTick;
+    mOverloadLevel = static_cast<EOverloadLevel>(newLevel);
+
+    ::ReleaseSRWLockExclusive(&mOverloadLock);
+
+    if (mOverloadLevel >= EOverloadLevel::PauseAccept)
+    {
+        PauseAccept();
+    }
+    else
+    {
+        ResumeAccept();
+    }
+
+    LOGF(ELogLevel::System, L"Overload Level %d -> %d (WorkQueue Size = %u, Lag = %u)", currentLevel, newLevel, workQueueSize, lag);
+}
+
+uint64_t ChatServer::GetOverloadLevelTime(const EOverloadLevel level) const
+{
+    // Ʈ 尡 ܰ踦 ٲٴ    ʵ  ȿ д´
+    ::AcquireSRWLockShared(&mOverloadLock);
+
+    uint64_t time = mOverloadLevelTime[static_cast<int>(level)];
+
+    //  ܰ  ڷ  ð Ѵ
+    if (level == mOverloadLevel)
+    {
+        time += ::timeGetTime() - mOverloadLevelEnterTick;
+    }
+
+    ::ReleaseSRWLockShared(&mOverloadLock);
+
+    return time;
 }
 
 void ChatServer::process_SessionAccept(const uint64_t sessionID)
 {
     Player* player = mPlayerPool.Alloc();
 
-    player->Init(sessionID);
+    player->Init(sessionID, mCurrentTick);
 
     mPlayerMap.insert(std::make_pair(sessionID, player));
+
+    resetTimeout(player);
 }
 
 void ChatServer::process_SessionReleased(const uint64_t sessionID)
@@ -134,12 +226,14 @@ void ChatServer::process_SessionReleased(const uint64_t sessionID)
         mRealPlayerCount--;
     }
 
+    mTimeoutTimers.Cancel(player->GetTimeoutTimer());
+
     mPlayerMap.erase(player->GetSessionID());
 
     mPlayerPool.Free(player);
 }
 
-void ChatServer::process_CS_CHAT_REQ_LOGIN(const uint64_t sessionID, const int64_t accountNo, const WCHAR id[], const WCHAR nickName[], const char sessionKey[])
+void ChatServer::process_CS_CHAT_REQ_LOGIN(const uint64_t sessionID, const CS_CHAT_REQ_LOGIN& message)
 {
     Player* player = findPlayerOrNull(sessionID);
     if (player == nullptr)
@@ -154,6 +248,19 @@ void ChatServer::process_CS_CHAT_REQ_LOGIN(const uint64_t sessionID, const int64
         return;
     }
 
+    //  - α  ÷̾ ΰ   ÷̾ Ѵ
+    if (mOverloadLevel >= EOverloadLevel::RejectLogin)
+    {
+        mOverloadRejectedLoginCount++;
+
+        Serializer* rejectPacket = Encode_CS_CHAT_RES_LOGIN(dfCHAT_LOGIN_ERR_OVERLOAD, message.AccountNo);
+
+        SendAndDisconnect(sessionID, rejectPacket);
+
+        Serializer::Free(rejectPacket);
+        return;
+    }
+
     if (true == mbRedisUsed)
     {
         static cpp_redis::client redisClient;
@@ -165,14 +272,14 @@ void ChatServer::process_CS_CHAT_REQ_LOGIN(const uint64_t sessionID, const int64
 
         bool bIsValidSessionKey = false;
 
-        redisClient.get(std::to_string(accountNo), [&](cpp_redis::reply& reply) {
+        redisClient.get(std::to_string(message.AccountNo), [&](cpp_redis::reply& reply) {
 
             if (reply.is_null())
             {
                 return;
             }
 
-            if (strncmp(reply.as_string().c_str(), sessionKey, 64) == 0)
+            if (strncmp(reply.as_string().c_str(), message.SessionKey, 64) == 0)
             {
                 bIsValidSessionKey = true;
             }
@@ -186,26 +293,27 @@ void ChatServer::process_CS_CHAT_REQ_LOGIN(const uint64_t sessionID, const int64
         redisClient.sync_commit();
 
         std::vector<std::string> toDeleteKeys;
-        toDeleteKeys.push_back(std::to_string(accountNo));
+        toDeleteKeys.push_back(std::to_string(message.AccountNo));
         redisClient.del(toDeleteKeys);
         redisClient.sync_commit();
     }
 
-    player->UpdateLastRecvTick();
-
-    player->LogIn(accountNo, id, nickName, sessionKey);
+    player->LogIn(message.AccountNo, message.ID, message.Nickname, message.SessionKey);
     mRealPlayerCount++;
 
-    Serializer* packet = createMessage_CS_CHAT_RES_LOGIN(1, accountNo);
+    // α Ƿ α  ŸӾƿ ٽ Ǵ
+    resetTimeout(player);
+
+    Serializer* packet = Encode_CS_CHAT_RES_LOGIN(dfCHAT_LOGIN_OK, message.AccountNo);
 
     SendPacket(sessionID, packet);
 
     Serializer::Free(packet);
 }
 
-void ChatServer::process_CS_CHAT_REQ_SECTOR_MOVE(const uint64_t sessionID, const int64_t accountNo, const WORD sectorX, const WORD sectorY)
+void ChatServer::process_CS_CHAT_REQ_SECTOR_MOVE(const uint64_t sessionID, const CS_CHAT_REQ_SECTOR_MOVE& message)
 {
-    if (sectorX >= 50 || sectorY >= 50)
+    if (message.SectorX >= 50 || message.SectorY >= 50)
     {
         LOGF(ELogLevel::System, L"Disconnect(%llu): CS_CHAT_REQ_SECTOR_MOVE invalid sector X/Y", sessionID);
         Disconnect(sessionID);
@@ -225,32 +333,32 @@ void ChatServer::process_CS_CHAT_REQ_SECTOR_MOVE(const uint64_t sessionID, const
         return;
     }
 
-    if (player->GetAccountNo() != accountNo)
+    if (player->GetAccountNo() != message.AccountNo)
     {
         LOGF(ELogLevel::System, L"Disconnect(%llu): CS_CHAT_REQ_SECTOR_MOVE different accountNo", sessionID);
         Disconnect(sessionID);
         return;
     }
 
-    player->UpdateLastRecvTick();
+    resetTimeout(player);
 
     if (player->IsSectorIn())
     {
         mSector[player->GetSectorY()][player->GetSectorX()].remove(player->GetSessionID());
     }
 
-    player->MoveSector(sectorX, sectorY);
+    player->MoveSector(message.SectorX, message.SectorY);
 
     mSector[player->GetSectorY()][player->GetSectorX()].push_back(player->GetSessionID());
 
-    Serializer* packet = createMessage_CS_CHAT_RES_SECTOR_MOVE(player->GetAccountNo(), player->GetSectorX(), player->GetSectorY());
+    Serializer* packet = Encode_CS_CHAT_RES_SECTOR_MOVE(player->GetAccountNo(), player->GetSectorX(), player->GetSectorY());
 
     SendPacket(player->GetSessionID(), packet);
 
     Serializer::Free(packet);
 }
 
-void ChatServer::process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const int64_t accountNo, const WORD messageLen, const WCHAR message[])
+void ChatServer::process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const CS_CHAT_REQ_MESSAGE& message, Serializer* messageText)
 {
     Player* player = findPlayerOrNull(sessionID);
     if (player == nullptr)
@@ -265,18 +373,31 @@ void ChatServer::process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const int
         return;
     }
 
-    if (player->GetAccountNo() != accountNo)
+    if (player->GetAccountNo() != message.AccountNo)
     {
         LOGF(ELogLevel::System, L"Disconnect(%llu): CS_CHAT_REQ_MESSAGE different accountNo", sessionID);
         Disconnect(sessionID);
         return;
     }
 
-    player->UpdateLastRecvTick();
+    resetTimeout(player);
 
     ASSERT_LIVE(player->IsSectorIn(), L"CS_CHAT_REQ_MESSAGE player is not in any sector");
 
-    Serializer* packet = createMessage_CS_CHAT_RES_MESSAGE(player->GetAccountNo(), player->GetID(), player->GetNickName(), messageLen, message);
+    //  - äú  (û  ƮƮ  Ƿ ŸӾƿ  ʴ´)
+    if (mOverloadLevel >= EOverloadLevel::DropChat)
+    {
+        mOverloadDroppedChatCount++;
+        return;
+    }
+
+    Serializer* packet = Encode_CS_CHAT_RES_MESSAGE(player->GetAccountNo(), player->GetID(), player->GetNickName(), message.MessageLen, messageText);
+
+    // ä εĳƮ  Ŭ̾Ʈ SendQueue á   ȴ (DropOldest)
+    packet->SetDroppable(true);
+
+    // ֺ 9  ǵ Ƽ    (Ŷ  īƮ Ǹ ø ʴ´)
+    mBroadcastSessionIDs.clear();
 
     if (player->GetSectorY() > 0)
     {
@@ -284,20 +405,20 @@ void ChatServer::process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const int
         {
             for (uint64_t otherSession : mSector[player->GetSectorY() - 1][player->GetSectorX() - 1])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
         {
             for (uint64_t otherSession : mSector[player->GetSectorY() - 1][player->GetSectorX()])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
         if (player->GetSectorX() < SECTOR_WIDTH_AND_HEIGHT - 1)
         {
             for (uint64_t otherSession : mSector[player->GetSectorY() - 1][player->GetSectorX() + 1])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
     }
@@ -306,20 +427,20 @@ void ChatServer::process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const int
         {
             for (uint64_t otherSession : mSector[player->GetSectorY()][player->GetSectorX() - 1])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
         {
             for (uint64_t otherSession : mSector[player->GetSectorY()][player->GetSectorX()])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
         if (player->GetSectorX() < SECTOR_WIDTH_AND_HEIGHT - 1)
         {
             for (uint64_t otherSession : mSector[player->GetSectorY()][player->GetSectorX() + 1])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
     }
@@ -329,28 +450,30 @@ void ChatServer::process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const int
         {
             for (uint64_t otherSession : mSector[player->GetSectorY() + 1][player->GetSectorX() - 1])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
         {
             for (uint64_t otherSession : mSector[player->GetSectorY() + 1][player->GetSectorX()])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
         if (player->GetSectorX() < SECTOR_WIDTH_AND_HEIGHT - 1)
         {
             for (uint64_t otherSession : mSector[player->GetSectorY() + 1][player->GetSectorX() + 1])
             {
-                SendPacket(otherSession, packet);
+                mBroadcastSessionIDs.push_back(otherSession);
             }
         }
     }
 
+    SendPacketToMany(mBroadcastSessionIDs.data(), static_cast<uint32_t>(mBroadcastSessionIDs.size()), packet);
+
     Serializer::Free(packet);
 }
 
-void ChatServer::process_CS_CHAT_REQ_HEARTBEAT(const uint64_t sessionID)
+void ChatServer::process_CS_CHAT_REQ_HEARTBEAT(const uint64_t sessionID, const CS_CHAT_REQ_HEARTBEAT& message)
 {
     Player* player = findPlayerOrNull(sessionID);
     if (player == nullptr)
@@ -358,7 +481,61 @@ void ChatServer::process_CS_CHAT_REQ_HEARTBEAT(const uint64_t sessionID)
         return;
     }
 
-    player->UpdateLastRecvTick();
+    resetTimeout(player);
+}
+
+//  ޼ ProtocolSchema.txt handler CHAT_SERVER ߰ϰ process_<޼>()  (ũ ڵ ü ´)
+const std::array<ChatServer::PacketHandlerEntry, ChatServer::PACKET_HANDLER_COUNT> ChatServer::mPacketHandlers = []()
+{
+    std::array<PacketHandlerEntry, PACKET_HANDLER_COUNT> handlers{};
+
+#define REGISTER_FIXED_PACKET(Message)      handlers[PACKET_TYPE<Message>] = fixedPacketHandler<Message, &ChatServer::process_##Message>(L"process_" #Message);
+#define REGISTER_VARIABLE_PACKET(Message)   handlers[PACKET_TYPE<Message>] = variablePacketHandler<Message, &ChatServer::process_##Message>(L"process_" #Message);
+
+    CHAT_SERVER_PACKET_HANDLERS(REGISTER_FIXED_PACKET, REGISTER_VARIABLE_PACKET)
+
+#undef REGISTER_FIXED_PACKET
+#undef REGISTER_VARIABLE_PACKET
+
+    return handlers;
+}();
+
+void ChatServer::dispatchPacket(const uint64_t sessionID, Serializer* packet)
+{
+    WORD messageType;
+
+    if (packet->GetUseSize() < sizeof(messageType))
+    {
+        Disconnect(sessionID);
+        return;
+    }
+
+    *packet >> messageType;
+
+    if (messageType >= PACKET_HANDLER_COUNT)
+    {
+        Disconnect(sessionID);
+        return;
+    }
+
+    const PacketHandlerEntry& handler = mPacketHandlers[messageType];
+    const uint32_t bodySize = packet->GetUseSize() - sizeof(messageType);
+
+    //    Ÿ BodySize UINT32_MAX ⼭ ɷ
+    if (handler.bVariableSize ? bodySize < handler.BodySize : bodySize != handler.BodySize)
+    {
+        Disconnect(sessionID);
+        return;
+    }
+
+    PROFILE_BEGIN(handler.ProfileTag);
+    bool bDecoded = (this->*handler.Decoder)(sessionID, packet, bodySize);
+    PROFILE_END(handler.ProfileTag);
+
+    if (false == bDecoded)
+    {
+        Disconnect(sessionID);
+    }
 }
 
 unsigned int ChatServer::updateThread(void* chatServer)
@@ -367,8 +544,6 @@ unsigned int ChatServer::updateThread(void* chatServer)
 
     ChatServer* server = reinterpret_cast<ChatServer*>(chatServer);
 
-    DWORD lastTimeoutCheckTick = ::timeGetTime();
-
     HANDLE events[2]{};
     events[0] = server->mWorkQueueEvent;
     events[1] = server->mTimeOutCheckEvent;
@@ -379,12 +554,13 @@ unsigned int ChatServer::updateThread(void* chatServer)
     {
         ::WaitForMultipleObjects(2, events, FALSE, INFINITE);
 
-        // timeout check
-        if (::timeGetTime() - lastTimeoutCheckTick >= server->mTimeoutCheckInterval)
-        {
-            server->timeoutCheck();
-            lastTimeoutCheckTick = ::timeGetTime();
-        }
+        // ̹ ġ ð - ġ ȿ Ŵ ŸӾƿ   ð  Ѵ
+        server->mCurrentTick = ::timeGetTime();
+
+        // timeout check -  Ÿ̸Ӹ Ƿ ÷̾  
+        PROFILE_BEGIN(L"Timeout Check");
+        server->mTimeoutTimers.Advance(server->mCurrentTick, [server](const uint64_t sessionID) { server->onTimeout(sessionID); });
+        PROFILE_END(L"Timeout Check");
 
         // work loop
         while (server->mWorkQueue.TryDequeue(work))
@@ -408,6 +584,11 @@ unsigned int ChatServer::updateThread(void* chatServer)
                 server->mTotalMaxWorkQueueSize = workQueueSize;
             }
 
+            //  ̹ ġ ð  - ġ  ڿ  ۾  0
+            const int32_t lag = static_cast<int32_t>(server->mCurrentTick - work.EnqueueTick);
+
+            server->updateOverloadLevel(workQueueSize, lag > 0 ? static_cast<uint32_t>(lag) : 0, server->mCurrentTick);
+
             switch (work.WorkType)
             {
             case EWorkType::Accept:
@@ -426,105 +607,9 @@ unsigned int ChatServer::updateThread(void* chatServer)
             break;
             case EWorkType::Receive:
             {
-                Serializer* packet = work.Packet;
-
-                WORD messageType;
-
-                *packet >> messageType;
-
-                switch (messageType)
-                {
-                case en_PACKET_TYPE::en_PACKET_CS_CHAT_REQ_LOGIN:
-                {
-                    int64_t accountNo;
-                    WCHAR   id[20];
-                    WCHAR   nickName[20];
-                    char    sessionKey[64];
-
-                    constexpr uint32_t PACKET_SIZE = sizeof(messageType) + sizeof(accountNo) + sizeof(id) + sizeof(nickName) + sizeof(sessionKey);
-                    if (packet->GetUseSize() != PACKET_SIZE)
-                    {
-                        server->Disconnect(work.SessionID);
-                        break;
-                    }
-
-                    *packet >> accountNo;
-                    packet->GetByte((char*)id, sizeof(id));
-                    packet->GetByte((char*)nickName, sizeof(nickName));
-                    packet->GetByte((char*)sessionKey, sizeof(sessionKey));
-
-                    PROFILE_BEGIN(L"process_CS_CHAT_REQ_LOGIN");
-                    server->process_CS_CHAT_REQ_LOGIN(work.SessionID, accountNo, id, nickName, sessionKey);
-                    PROFILE_END(L"process_CS_CHAT_REQ_LOGIN");
-                }
-                break;
-                case en_PACKET_TYPE::en_PACKET_CS_CHAT_REQ_SECTOR_MOVE:
-                {
-                    int64_t accountNo;
-                    WORD    sectorX;
-                    WORD    sectorY;
-
-                    constexpr uint32_t PACKET_SIZE = sizeof(messageType) + sizeof(accountNo) + sizeof(sectorX) + sizeof(sectorY);
-                    if (packet->GetUseSize() != PACKET_SIZE)
-                    {
-                        server->Disconnect(work.SessionID);
-                        break;
-                    }
-
-                    *packet >> accountNo >> sectorX >> sectorY;
-
-                    PROFILE_BEGIN(L"process_CS_CHAT_REQ_SECTOR_MOVE");
-                    server->process_CS_CHAT_REQ_SECTOR_MOVE(work.SessionID, accountNo, sectorX, sectorY);
-                    PROFILE_END(L"process_CS_CHAT_REQ_SECTOR_MOVE");
-                }
-                break;
-                case en_PACKET_TYPE::en_PACKET_CS_CHAT_REQ_MESSAGE:
-                {
-                    int64_t         accountNo;
-                    WORD            messageLen;
-                    static WCHAR    message[UINT16_MAX / 2];
-
-                    constexpr uint32_t PACKET_MIN_SIZE = sizeof(messageType) + sizeof(accountNo) + sizeof(messageLen);
-                    if (packet->GetUseSize() < PACKET_MIN_SIZE)
-                    {
-                        server->Disconnect(work.SessionID);
-                        break;
-                    }
-
-                    *packet >> accountNo >> messageLen;
-
-                    if (packet->GetUseSize() != PACKET_MIN_SIZE + messageLen)
-                    {
-                        server->Disconnect(work.SessionID);
-                        break;
-                    }
-
-                    packet->GetByte((char*)message, messageLen);
-
-                    PROFILE_BEGIN(L"process_CS_CHAT_REQ_MESSAGE");
-                    server->process_CS_CHAT_REQ_MESSAGE(work.SessionID, accountNo, messageLen, message);
-                    PROFILE_END(L"process_CS_CHAT_REQ_MESSAGE");
-                }
-                break;
-                case en_PACKET_TYPE::en_PACKET_CS_CHAT_REQ_HEARTBEAT:
-                {
-                    constexpr uint32_t PACKET_SIZE = sizeof(messageType);
-                    if (packet->GetUseSize() != PACKET_SIZE)
-                    {
-                        server->Disconnect(work.SessionID);
-                        break;
-                    }
-
-                    PROFILE_BEGIN(L"process_CS_CHAT_REQ_HEARTBEAT");
-                    server->process_CS_CHAT_REQ_HEARTBEAT(work.SessionID);
-                    PROFILE_END(L"process_CS_CHAT_REQ_HEARTBEAT");
-                }
-                break;
-                default:
-                    server->Disconnect(work.SessionID);
-                }
-
-                Serializer::Free(packet);
+                server->dispatchPacket(work.SessionID, work.Packet);
+
+                Serializer::Free(work.Packet);
             }
             break;
             default:
@@ -536,6 +621,14 @@ unsigned int ChatServer::updateThread(void* chatServer)
 
             PROFILE_END(L"Update Loop");
         }
+
+        // ť   - и ۾ Ƿ  ܰ踦 
+        server->updateOverloadLevel(0, 0, server->mCurrentTick);
+
+        //  ۽  - ̹ ġ Ŷ  Ǹ ۽   Ǵ
+        PROFILE_BEGIN(L"FlushSends");
+        server->FlushSends();
+        PROFILE_END(L"FlushSends");
     }
 
     LOGF(ELogLevel::System, L"ChatServer UpdateThread End (ID : %d)", ::GetCurrentThreadId());
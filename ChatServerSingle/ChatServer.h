@@ -4,14 +4,27 @@
 #include "NetLibrary/DataStructure/LockFreeQueue.h"
 #include "Work.h"
 #include "Protocol.h"
+#include "ProtocolMessage.h"
 #include "Player.h"
 #include "NetLibrary/Memory/ObjectPool.h"
 
+#include <array>
 #include <vector>
 #include <map>
 #include <unordered_map>
 #include <list>
 
+// Ʈ   ܰ -  ܰ  ܰ ó  Ѵ
+enum class EOverloadLevel
+{
+	Normal,			// 
+	DropChat,		// ä εĳƮ  (ƮƮ,  ̵ ó)
+	RejectLogin,	//  α RES_LOGIN(dfCHAT_LOGIN_ERR_OVERLOAD) ϰ ´
+	PauseAccept,	//    ʴ´ (NetServer::PauseAccept)
+
+	Count
+};
+
 class ChatServer : public NetServer
 {
 public:
@@ -24,7 +37,7 @@ public:
 
 public: //     Լ
 
-	// Ÿ ƿ üũ 
+	// Ÿ ƿ üũ  - Ʈ 尡       Ÿ̸Ӹ 기
 	inline void		SetTimeoutCheckInterval(const uint32_t interval) { mTimeoutCheckInterval = interval; }
 	
 	// α  ִ ŸӾƿ ð
@@ -36,6 +49,14 @@ public: // 
 	//   
 	inline void		UseRedis(void) { mbRedisUsed = true; }
 
+	//  ܰ ͸ũ - Ʈ  ť ũ⳪ (ms, ť ٸ ð)   ܰ ö󰣴 (0̸   )
+	// ͸ũ  Ʒ  ܰ谡 ´ ( ܰ迡 ּ 1ʴ ӹ)
+	inline void		SetOverloadWatermark(const EOverloadLevel level, const uint32_t workQueueSize, const uint32_t lagMs)
+	{
+		mOverloadWorkQueueWatermarks[static_cast<int>(level)] = workQueueSize;
+		mOverloadLagWatermarks[static_cast<int>(level)] = lagMs;
+	}
+
 public:
 
 	//  
@@ -51,7 +72,7 @@ public:
 	// NetServer()  ӵ
 	virtual void OnAccept(const uint64_t sessionID) override;
 	virtual void OnRelease(const uint64_t sessionID) override;
-	virtual void OnReceive(const uint64_t sessionID, Serializer* packet) override;
+	virtual void OnReceive(const uint64_t sessionID, PacketView& packet) override;
 
 public: // , 
 
@@ -76,6 +97,14 @@ public: // 
 	// Ʈ  ť ޼ ó Ƚ ȯ  0 ʱȭ ͸)
 	inline uint32_t	GetProcessedMessageCountPerSecond(void) { return InterlockedExchange(&mProcessedMessageCountPerSecond, 0); }
 
+	inline EOverloadLevel GetOverloadLevel(void) const { return mOverloadLevel; }
+
+	//    ش  ܰ迡 ӹ ð (ms, ͸)
+	uint64_t		GetOverloadLevelTime(const EOverloadLevel level) const;
+
+	inline uint64_t	GetOverloadDroppedChatCount(void) const { return mOverloadDroppedChatCount; }
+	inline uint64_t	GetOverloadRejectedLoginCount(void) const { return mOverloadRejectedLoginCount; }
+
 	//  Ϳ ϴ ÷̾  ȯ
 	// Ȯ    ƴϸ, 뷫  ľ
 	inline void		GetSectorNonitorInfos(std::vector<SectorMonitorInfo>* outDatas)
@@ -102,16 +131,16 @@ public: // 
 private: // ޼ 
 
 	// α û
-	void process_CS_CHAT_REQ_LOGIN(const uint64_t sessionID, const int64_t accountNo, const WCHAR id[], const WCHAR nickName[], const char sessionKey[]);
+	void process_CS_CHAT_REQ_LOGIN(const uint64_t sessionID, const CS_CHAT_REQ_LOGIN& message);
 	
 	//  ̵ û
-	void process_CS_CHAT_REQ_SECTOR_MOVE(const uint64_t sessionID, const int64_t accountNo, const WORD sectorX, const WORD sectorY);
+	void process_CS_CHAT_REQ_SECTOR_MOVE(const uint64_t sessionID, const CS_CHAT_REQ_SECTOR_MOVE& message);
 	
-	// ä
-	void process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const int64_t accountNo, const WORD messageLen, const WCHAR message[]);
+	// ä (messageText  Ŷ̸  ġ message.MessageLen Ʈ  - ׸Ʈ    ִ)
+	void process_CS_CHAT_REQ_MESSAGE(const uint64_t sessionID, const CS_CHAT_REQ_MESSAGE& message, Serializer* messageText);
 	
 	// ƮƮ
-	void process_CS_CHAT_REQ_HEARTBEAT(const uint64_t sessionID);
+	void process_CS_CHAT_REQ_HEARTBEAT(const uint64_t sessionID, const CS_CHAT_REQ_HEARTBEAT& message);
 	
 	//  connect
 	void process_SessionAccept(const uint64_t sessionID);
@@ -119,36 +148,78 @@ private: // 
 	//  disconnect
 	void process_SessionReleased(const uint64_t sessionID);
 
-	inline static Serializer* createMessage_CS_CHAT_RES_LOGIN(const BYTE Status, const int64_t AccountNo)
+	//  ޼ ProtocolMessage.h Encode_<޼>() 
+
+private: //  Ŷ ġ
+
+	enum
 	{
-		Serializer* packet = Serializer::Alloc();
+		PACKET_HANDLER_COUNT = CHAT_SERVER_PACKET_TYPE_END	// Ŭ̾Ʈ  ޼ Ÿ  (̸̻  )
+	};
 
-		*packet << (WORD)en_PACKET_CS_CHAT_RES_LOGIN << Status << AccountNo;
+	// ũ ˻縦  (packet  ġ, Type ) ޼ Ǯ process_ Լ ѱ, ߸ ̶ false ( )
+	//  ù ۸  ׸Ʈ  Ƿ ͷ  ʰ packet 
+	using PacketDecoder = bool (ChatServer::*)(const uint64_t sessionID, Serializer* packet, const uint32_t bodySize);
 
-		return packet;
-	}
-	inline static Serializer* createMessage_CS_CHAT_RES_SECTOR_MOVE(const int64_t AccountNo, const WORD sectorX, const WORD sectorY)
+	struct PacketHandlerEntry
+	{
+		PacketDecoder	Decoder = nullptr;			// nullptr̶ Ŭ̾Ʈ    Ÿ
+		uint32_t		BodySize = UINT32_MAX;		//  ̶  ũ,  ̶ ּ ũ (   Ÿ  ũ͵  ʴ´)
+		bool			bVariableSize = false;
+		const WCHAR*	ProfileTag = nullptr;
+	};
+
+	//   ޼ -  Message ؼ Process ѱ
+	template <typename Message, void (ChatServer::*Process)(const uint64_t, const Message&)>
+	bool decodeFixedPacket(const uint64_t sessionID, Serializer* packet, const uint32_t bodySize)
 	{
-		Serializer* packet = Serializer::Alloc();
+		Message message;
 
-		*packet << (WORD)en_PACKET_CS_CHAT_RES_SECTOR_MOVE << AccountNo << sectorX << sectorY;
+		if constexpr (PACKET_BODY_SIZE<Message> > 0)
+		{
+			packet->GetByte(reinterpret_cast<char*>(&message), PACKET_BODY_SIZE<Message>);
+		}
+
+		(this->*Process)(sessionID, message);
 
-		return packet;
+		return true;
 	}
-	inline static Serializer* createMessage_CS_CHAT_RES_MESSAGE(const int64_t AccountNo, const WCHAR id[], const WCHAR nickName[], const WORD messageLen, const WCHAR message[])
+
+	//   ޼ - Message ڿ Message::GetTailSize() Ʈ Ȯ پ ־ Ѵ, ޺κ  ʰ ޺κ տ ġ packet ѱ
+	template <typename Message, void (ChatServer::*Process)(const uint64_t, const Message&, Serializer*)>
+	bool decodeVariablePacket(const uint64_t sessionID, Serializer* packet, const uint32_t bodySize)
 	{
-		Serializer* packet = Serializer::Alloc();
+		Message message;
+		packet->GetByte(reinterpret_cast<char*>(&message), PACKET_BODY_SIZE<Message>);
 
-		*packet << (WORD)en_PACKET_CS_CHAT_RES_MESSAGE << AccountNo;
-		packet->InsertByte((const char*)id, sizeof(WCHAR) * 20);
-		packet->InsertByte((const char*)nickName, sizeof(WCHAR) * 20);
+		if (bodySize != PACKET_BODY_SIZE<Message> + message.GetTailSize())
+		{
+			return false;
+		}
+
+		(this->*Process)(sessionID, message, packet);
 
-		*packet << messageLen;
-		packet->InsertByte((const char*)message, messageLen);
+		return true;
+	}
 
-		return packet;
+	template <typename Message, void (ChatServer::*Process)(const uint64_t, const Message&)>
+	static constexpr PacketHandlerEntry fixedPacketHandler(const WCHAR* profileTag)
+	{
+		return { &ChatServer::decodeFixedPacket<Message, Process>, PACKET_BODY_SIZE<Message>, false, profileTag };
 	}
 
+	template <typename Message, void (ChatServer::*Process)(const uint64_t, const Message&, Serializer*)>
+	static constexpr PacketHandlerEntry variablePacketHandler(const WCHAR* profileTag)
+	{
+		return { &ChatServer::decodeVariablePacket<Message, Process>, PACKET_BODY_SIZE<Message>, true, profileTag };
+	}
+
+	// ޼ Ÿ mPacketHandlers ã ũ⸦ ˻ϰ óѴ, ߸ Ŷ̶  ´
+	void dispatchPacket(const uint64_t sessionID, Serializer* packet);
+
+	// en_PACKET_TYPE ٷ ã  Ŷ ó ̺ (ChatServer.cpp, CHAT_SERVER_PACKET_HANDLERS ä)
+	static const std::array<PacketHandlerEntry, PACKET_HANDLER_COUNT> mPacketHandlers;
+
 private:
 
 	// ̱ Ʈ 
@@ -157,14 +228,22 @@ private:
 	//  ID  ÷̾ ´
 	Player* findPlayerOrNull(const uint64_t sessionID);
 
-	// mPlayerMap ȸϸ鼭 ŸӾƿ üũ
-	void timeoutCheck(void);
+	// Ŷ  ÷̾ ŸӾƿ ٽ Ǵ (α ο  ð ٸ)
+	void resetTimeout(Player* player);
+
+	// ŸӾƿ Ÿ̸  -  ´
+	void onTimeout(const uint64_t sessionID);
+
+	// ť ũ   ܰ踦 ٽ Ѵ (Ʈ 忡 ȣ)
+	void updateOverloadLevel(const uint32_t workQueueSize, const uint32_t lag, const uint32_t currentTick);
 
 private:
 
 	enum
 	{
 		SECTOR_WIDTH_AND_HEIGHT = 50,
+		OVERLOAD_LEVEL_HOLD_MS = 1'000,	//  ܰ谡   ӹ ּ ð
+		TIMEOUT_RESOLUTION_MS = 100,	// ŸӾƿ Ÿ̸ ƽ (ŸӾƿ ̸ŭ ʰ ó  ִ)
 	};
 
 	HANDLE									mUpdateThread;
@@ -182,11 +261,23 @@ private:
 	uint32_t								mRealPlayerCount = 0; //   ÷̾ 
 
 	std::list<uint64_t>						mSector[SECTOR_WIDTH_AND_HEIGHT][SECTOR_WIDTH_AND_HEIGHT];
+	std::vector<uint64_t>					mBroadcastSessionIDs;	// ä ޼  ǵ   (Ʈ  , 뷮 )
 
 	HANDLE									mTimeOutCheckEvent;
 	uint32_t								mTimeoutCheckInterval;
 	uint32_t								mTimeoutLoggedIn;
 	uint32_t								mTimeoutNotLoggedIn;
+	TimerService							mTimeoutTimers;		// ÷̾ ŸӾƿ (Ʈ  )
+	uint32_t								mCurrentTick;		// Ʈ  ð -     Ѵ
 
 	bool									mbRedisUsed;
+
+	EOverloadLevel							mOverloadLevel;
+	uint32_t								mOverloadWorkQueueWatermarks[static_cast<int>(EOverloadLevel::Count)];
+	uint32_t								mOverloadLagWatermarks[static_cast<int>(EOverloadLevel::Count)];
+	uint32_t								mOverloadLevelEnterTick;	//  ܰ迡  ð
+	uint64_t								mOverloadLevelTime[static_cast<int>(EOverloadLevel::Count)];	// ܰ躰 ӹ ð ( ܰ  )
+	mutable SRWLOCK							mOverloadLock;		// ܰ踦 ٲ  (Ʈ ) GetOverloadLevelTime() ´
+	uint64_t								mOverloadDroppedChatCount;
+	uint64_t								mOverloadRejectedLoginCount;
 };
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "NetLibrary/NetServer/Serializer.h"
 
 #include "Protocol.h"
+#include "ProtocolMessage.h"
 
 class MonitorClient : public NetClient
 {
@@ -23,9 +24,7 @@ public:
 
     void SendLoginPacket(void)
     {
-        Serializer* packet = Serializer::Alloc();
-
-        *packet << (WORD)en_PACKET_SS_MONITOR_LOGIN << LOGIN_SERVER_NO;
+        Serializer* packet = Encode_SS_MONITOR_LOGIN(LOGIN_SERVER_NO);
 
         SendPacket(packet);
 
@@ -34,15 +33,7 @@ public:
 
     void Send_LOGIN_SERVER_RUN(void)
     {
-        Serializer* packet = Serializer::Alloc();
-
-        int dataValue = 1;
-
-        *packet << (WORD)en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE
-            << (BYTE)LOGIN_SERVER_NO
-            << (BYTE)dfMONITOR_DATA_TYPE_LOGIN_SERVER_RUN
-            << dataValue
-            << (int)time(nullptr);
+        Serializer* packet = Encode_CS_MONITOR_TOOL_DATA_UPDATE(LOGIN_SERVER_NO, dfMONITOR_DATA_TYPE_LOGIN_SERVER_RUN, 1, static_cast<int32_t>(time(nullptr)));
 
         SendPacket(packet);
 
@@ -51,9 +42,7 @@ public:
 
     void Send_MONITOR_DATA_UPDATE(const BYTE dataType, const int32_t dataValue, const int32_t timeStamp)
     {
-        Serializer* packet = Serializer::Alloc();
-
-        *packet << (WORD)en_PACKET_SS_MONITOR_DATA_UPDATE << dataType << dataValue << timeStamp;
+        Serializer* packet = Encode_SS_MONITOR_DATA_UPDATE(dataType, dataValue, timeStamp);
 
         SendPacket(packet);
 
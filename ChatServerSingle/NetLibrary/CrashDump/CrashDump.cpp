@@ -4,6 +4,11 @@
 
 #include "CrashDump.h"
 
+#ifndef _WIN32
+#include <sys/prctl.h>
+#include <sys/resource.h>
+#endif
+
 DWORD CrashDump::s_mDumpCount;
 CrashDump CrashDump::s_mInstance;
 
@@ -16,6 +21,8 @@ void CrashDump::Crash()
 #pragma warning(pop)
 }
 
+#ifdef _WIN32
+
 CrashDump::CrashDump()
 {
 	s_mDumpCount = 0;
@@ -67,4 +74,19 @@ LONG WINAPI CrashDump::myExceptionFilter(PEXCEPTION_POINTERS pExceptionPointer)
 	::CloseHandle(hDumpFile);
 
 	return EXCEPTION_EXECUTE_HANDLER;
-}
\ No newline at end of file
+}
+
+#else
+
+CrashDump::CrashDump()
+{
+	s_mDumpCount = 0;
+
+	// ũ  ھ   ũ  Ѵ ( δ core_pattern )
+	rlimit coreLimit{ RLIM_INFINITY, RLIM_INFINITY };
+	::setrlimit(RLIMIT_CORE, &coreLimit);
+
+	::prctl(PR_SET_DUMPABLE, 1);
+}
+
+#endif
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
+#ifdef _WIN32
 #include <Windows.h>
 #include <DbgHelp.h>
+#else
+#include "../Platform/LinuxCompat.h"
+#endif
 
 class CrashDump
 {
@@ -12,12 +16,14 @@ public:
 private:
 	CrashDump();
 
+#ifdef _WIN32
 	//  ڵ鷯 - ũ  
 	static LONG WINAPI myExceptionFilter(PEXCEPTION_POINTERS pExceptionPointer);
 
 	static void myInvalidParameterHandler(const wchar_t* expression, const wchar_t* function, const wchar_t* file, unsigned int line, uintptr_t pReserved) { Crash(); }
 	static int _custom_Report_hook(int ireposttype, char* message, int* returnValue) { Crash(); return TRUE; }
 	static void myPurecallHandler() { Crash(); }
+#endif
 
 private:
 	static DWORD s_mDumpCount;
@@ -112,6 +112,68 @@ public:
         return true;
     }
 
+    //   Ͱ predicate(data)    -  ʴ´ٸ false (ť ״)
+    template <typename Predicate>
+    bool TryDequeueIf(T& outData, Predicate&& predicate)
+    {
+        if (mCount == 0)
+        {
+            return false;
+        }
+
+        Node* localMyHead;
+        Node* localMyTail;
+        Node* localMyPureHead;
+        Node* localMyHeadNext;
+        Node* localMyPureHeadNext;
+
+        do
+        {
+        RETRY:
+            localMyHead = mHead;
+            localMyTail = mTail;
+            localMyPureHead = getPurePointer(localMyHead);
+            localMyHeadNext = localMyPureHead->Next;
+            localMyPureHeadNext = getPurePointer(localMyHeadNext);
+
+            if (localMyHead == localMyTail)
+            {
+                if (mCount == 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    goto RETRY;
+                }
+            }
+
+            if (localMyPureHeadNext == nullptr)
+            {
+                goto RETRY;
+            }
+
+            outData = localMyPureHeadNext->Data;
+
+            //  ̿ ٸ 尡 ´ٸ     Ͱ ƴϹǷ ٽ ȮѴ
+            if (false == predicate(outData))
+            {
+                if (mHead != localMyHead)
+                {
+                    goto RETRY;
+                }
+
+                return false;
+            }
+        } while (InterlockedCompareExchangePointer((PVOID*)&mHead, localMyHeadNext, localMyHead) != localMyHead);
+
+        mNodePool.Free(localMyPureHead);
+
+        InterlockedDecrement(&mCount);
+
+        return true;
+    }
+
     uint32_t Clear(void)
     {
         uint32_t dequeueCount = 0;
@@ -3,8 +3,19 @@
 #include "Logger.h"
 
 #include <time.h>
+
+#ifdef _WIN32
 #include <Windows.h>
 #include <strsafe.h>
+#else
+#include <cstdarg>
+#include <sys/stat.h>
+
+#include "../Platform/LinuxCompat.h"
+
+#define StringCchPrintfW	swprintf
+#define StringCchVPrintfW	vswprintf
+#endif
 
 #define LOG_MESSAGE_MAX_LENGTH 512
 #define DAY_INFO_BUFFER_LENGTH 16
@@ -17,6 +28,8 @@ ELogLevel Logger::mLogLevel = ELogLevel::Debug;
 // ֿܼ α׸ 
 #define LOG_TO_CONSOLE(Log) wprintf(Log)
 
+#ifdef _WIN32
+
 // α Ͽ α׸ 
 #define LOG_TO_LOG_FILE(Log) do {																				\
 	if (WriteFile(mhLogFile, (Log), (DWORD)(wcslen(Log) * sizeof(WCHAR)), nullptr, nullptr) == FALSE)			\
@@ -37,6 +50,22 @@ ELogLevel Logger::mLogLevel = ELogLevel::Debug;
 	FlushFileBuffers(mhMonitorFile);																			\
 } while (false)																									\
 
+#else
+
+// α Ͽ α׸  (wchar_t ״  - UTF-32LE)
+#define LOG_TO_LOG_FILE(Log) do {																				\
+	fwrite((Log), sizeof(WCHAR), wcslen(Log), reinterpret_cast<FILE*>(mhLogFile));								\
+	fflush(reinterpret_cast<FILE*>(mhLogFile));																	\
+} while (false)																									\
+
+// ͸ Ͽ α׸ 
+#define LOG_TO_MONITOR_FILE(Log) do {																			\
+	fwrite((Log), sizeof(WCHAR), wcslen(Log), reinterpret_cast<FILE*>(mhMonitorFile));							\
+	fflush(reinterpret_cast<FILE*>(mhMonitorFile));																\
+} while (false)																									\
+
+#endif
+
 void Logger::LogMonitor(const WCHAR * formatMessage, ...)
 {
 	WCHAR completedMessage[LOG_MESSAGE_MAX_LENGTH];
@@ -50,7 +79,7 @@ void Logger::LogMonitor(const WCHAR * formatMessage, ...)
 
 	WCHAR log[LOG_MESSAGE_MAX_LENGTH];
 
-	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"%s\n", completedMessage);
+	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"%ls\n", completedMessage);
 
 	LOG_TO_CONSOLE(log);
 	LOG_TO_MONITOR_FILE(log);
@@ -65,7 +94,7 @@ void Logger::LogMessage(ELogLevel logLevel, const WCHAR * message)
 
 	WCHAR log[LOG_MESSAGE_MAX_LENGTH];
 
-	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"%s\n", message);
+	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"%ls\n", message);
 
 	LOG_TO_CONSOLE(log);
 	LOG_TO_LOG_FILE(log);
@@ -82,7 +111,7 @@ void Logger::LogMessageWithTime(ELogLevel logLevel, const WCHAR* message)
 	WCHAR dayInfo[DAY_INFO_BUFFER_LENGTH];
 	getCurrentTimeInfo(dayInfo);
 
-	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[%s] : %s\n", dayInfo, message);
+	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[%ls] : %ls\n", dayInfo, message);
 
 	LOG_TO_CONSOLE(log);
 	LOG_TO_LOG_FILE(log);
@@ -99,7 +128,7 @@ void Logger::LogMessageWithTime(ELogLevel logLevel, const WCHAR* message, const
 	WCHAR dayInfo[DAY_INFO_BUFFER_LENGTH];
 	getCurrentTimeInfo(dayInfo);
 
-	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[%s][%s line:%4d] : %s\n", dayInfo, fileName, line, message);
+	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[%ls][%ls line:%4d] : %ls\n", dayInfo, fileName, line, message);
 
 	LOG_TO_CONSOLE(log);
 	LOG_TO_LOG_FILE(log);
@@ -130,7 +159,7 @@ void Logger::LogCurrentTime(void)
 	WCHAR dayInfo[DAY_INFO_BUFFER_LENGTH];
 	getCurrentTimeInfo(dayInfo);
 
-	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"<%s>\n", dayInfo);
+	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"<%ls>\n", dayInfo);
 
 	LOG_TO_CONSOLE(log);
 	LOG_TO_MONITOR_FILE(log);
@@ -179,6 +208,8 @@ void Logger::RaiseCrash()
 }
 #pragma warning(pop)
 
+#ifdef _WIN32
+
 Logger::Logger()
 {
 	timeBeginPeriod(1);
@@ -230,4 +261,54 @@ Logger::Logger()
 Logger::~Logger()
 {
 	CloseHandle(mhLogFile);
-}
\ No newline at end of file
+}
+
+#else
+
+Logger::Logger()
+{
+	WCHAR dayInfo[DAY_INFO_BUFFER_LENGTH];
+	getCurrentTimeInfo(dayInfo);
+
+	// get process path
+	char processPath[MAX_PATH];
+	ssize_t processPathLength = readlink("/proc/self/exe", processPath, MAX_PATH - 1);
+	if (processPathLength <= 0)
+	{
+		exit(1);
+	}
+	processPath[processPathLength] = '\0';
+
+	std::string logDirectory = std::string(processPath) + " Log";
+	mkdir(logDirectory.c_str(), 0755); // create directory
+
+	std::string narrowDayInfo = WideToUtf8(dayInfo);
+
+	std::string fileName = logDirectory + "/Log_" + narrowDayInfo + ".txt";
+	mhLogFile = fopen(fileName.c_str(), "wb");
+	if (mhLogFile == nullptr)
+	{
+		printf("Log File fopen() Failed %d\n", errno);
+		RaiseCrash();
+	}
+
+	fileName = logDirectory + "/Monitor_" + narrowDayInfo + ".txt";
+	mhMonitorFile = fopen(fileName.c_str(), "wb");
+	if (mhMonitorFile == nullptr)
+	{
+		printf("Monitoring Log File fopen() Failed %d\n", errno);
+		RaiseCrash();
+	}
+
+	// Write BOM
+	constexpr WCHAR BOM_UTF_32_LE = 0xFEFF;
+	fwrite(&BOM_UTF_32_LE, sizeof(BOM_UTF_32_LE), 1, reinterpret_cast<FILE*>(mhLogFile));
+	fwrite(&BOM_UTF_32_LE, sizeof(BOM_UTF_32_LE), 1, reinterpret_cast<FILE*>(mhMonitorFile));
+}
+
+Logger::~Logger()
+{
+	fclose(reinterpret_cast<FILE*>(mhLogFile));
+}
+
+#endif
\ No newline at end of file
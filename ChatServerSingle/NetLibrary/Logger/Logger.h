@@ -14,10 +14,10 @@
 #define LOG_WITH_LINE(Level, Log)		Logger::LogMessageWithTime((Level), (Log), __FILEW__, __LINE__)
 
 //  α
-#define LOGF(Level, FormatString, ...)	Logger::LogFormatWithTime(Level, FormatString, __VA_ARGS__)
+#define LOGF(Level, FormatString, ...)	Logger::LogFormatWithTime(Level, FormatString, ##__VA_ARGS__)
 
 // ͸ α (¥ ǥ  α븸 )
-#define LOG_MONITOR(FormatString, ...)	Logger::LogMonitor(FormatString, __VA_ARGS__)
+#define LOG_MONITOR(FormatString, ...)	Logger::LogMonitor(FormatString, ##__VA_ARGS__)
 
 // ͸ α׿  ð  α׸ 
 #define LOG_CURRENT_TIME()				Logger::LogCurrentTime()
@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+// ũ  ȸ (Epoch Based Reclamation)
+//  ī( īƮ) ǵ帮 ʰ ü д  Enter() ~ Leave() ̿ д´
+// ü   ü  ̻  ã     Retire()  ũ Բ  ΰ,
+// GetMinActiveEpoch()  ũ ̻  ڿ Ѵ (   尡   )
+///////////////////////////////////////////////////////////////////////////////
+
+///////////////////////////////////////////////////////////////////////////////
+// 帶  ϳ ó Enter()   ϰ  Ѵ (  ID  ̾޴´)
+//  ĳ    Ƿ Enter()/Leave() ٸ  ĳ   ʴ´
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include "../Platform/LinuxCompat.h"
+#endif
+
+#include "../CrashDump/CrashDump.h"
+
+class EpochDomain
+{
+public:
+    enum : uint32_t
+    {
+        MAX_SLOT_COUNT = 256,       // Enter() ȣ  ִ  
+        CACHE_LINE_SIZE = 64
+    };
+
+    enum : int64_t
+    {
+        IDLE_EPOCH = 0,             //  尡 б  ۿ 
+        NO_ACTIVE_EPOCH = INT64_MAX // б  ִ 尡   GetMinActiveEpoch()
+    };
+
+    EpochDomain(void) = default;
+
+    EpochDomain(const EpochDomain& other) = delete;
+    EpochDomain& operator=(const EpochDomain& other) = delete;
+
+    // б   (ø ,  忡 Leave() ¦ )
+    inline void Enter(void)
+    {
+        Slot* slot = getThreadSlot();
+
+        if (slot->Depth++ != 0)
+        {
+            return;
+        }
+
+        //  ũ  ڿ  ũ Ѵ
+        // (о  ϱ  Retire() ٸ, ȸϴ   带    ִ)
+        int64_t epoch = mGlobalEpoch;
+
+        for (;;)
+        {
+            InterlockedExchange64(&slot->Epoch, epoch);
+
+            int64_t currentEpoch = mGlobalEpoch;
+            if (currentEpoch == epoch)
+            {
+                break;
+            }
+
+            epoch = currentEpoch;
+        }
+    }
+
+    inline void Leave(void)
+    {
+        Slot* slot = getThreadSlot();
+
+        CrashDump::Assert(slot->Depth > 0);
+
+        if (--slot->Depth == 0)
+        {
+            InterlockedExchange64(&slot->Epoch, IDLE_EPOCH);
+        }
+    }
+
+    // ü  ̻  ã    ڿ ȣѴ ( ũ ̻   ° δ)
+    inline int64_t Retire(void) { return InterlockedIncrement64(&mGlobalEpoch); }
+
+    // б  ִ   ũ     - retireEpoch ϶ retireEpoch  ü ص ȴ
+    int64_t GetMinActiveEpoch(void) const
+    {
+        int64_t minEpoch = NO_ACTIVE_EPOCH;
+        uint32_t slotCount = mSlotCount < MAX_SLOT_COUNT ? mSlotCount : MAX_SLOT_COUNT;
+
+        for (uint32_t i = 0; i < slotCount; ++i)
+        {
+            int64_t epoch = mSlots[i].Epoch;
+
+            if (epoch != IDLE_EPOCH && epoch < minEpoch)
+            {
+                minEpoch = epoch;
+            }
+        }
+
+        return minEpoch;
+    }
+
+private:
+
+    struct alignas(CACHE_LINE_SIZE) Slot
+    {
+        volatile int64_t    Epoch = IDLE_EPOCH;     // б    ũ (̶ IDLE_EPOCH)
+        DWORD               OwnerThreadId = 0;
+        uint32_t            Depth = 0;              // Enter() ø  ( 常 )
+    };
+
+    struct ThreadSlotCache
+    {
+        const EpochDomain*  Owner;
+        Slot*               ThreadSlot;
+    };
+
+    inline Slot* getThreadSlot(void)
+    {
+        if (l_threadSlotCache.Owner == this)
+        {
+            return l_threadSlotCache.ThreadSlot;
+        }
+
+        Slot* slot = findOrRegisterSlot(::GetCurrentThreadId());
+
+        l_threadSlotCache.Owner = this;
+        l_threadSlotCache.ThreadSlot = slot;
+
+        return slot;
+    }
+
+    //   ID ̾    ״ Ѵ (   ׻ IDLE_EPOCH)
+    Slot* findOrRegisterSlot(const DWORD threadId)
+    {
+        uint32_t slotCount = mSlotCount < MAX_SLOT_COUNT ? mSlotCount : MAX_SLOT_COUNT;
+
+        for (uint32_t i = 0; i < slotCount; ++i)
+        {
+            if (mSlots[i].OwnerThreadId == threadId)
+            {
+                return &mSlots[i];
+            }
+        }
+
+        uint32_t newIndex = InterlockedIncrement(&mSlotCount) - 1;
+
+        // 带     MAX_SLOT_COUNT ÷ Ѵ
+        CrashDump::Assert(newIndex < MAX_SLOT_COUNT);
+
+        mSlots[newIndex].OwnerThreadId = threadId;
+
+        return &mSlots[newIndex];
+    }
+
+private:
+    alignas(CACHE_LINE_SIZE)
+    volatile int64_t    mGlobalEpoch = IDLE_EPOCH + 1;
+    uint32_t            mSlotCount = 0;             // ϵ   (տ ä)
+    Slot                mSlots[MAX_SLOT_COUNT];
+
+    inline static thread_local ThreadSlotCache l_threadSlotCache{};
+};
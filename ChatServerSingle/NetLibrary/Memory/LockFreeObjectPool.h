@@ -1,7 +1,11 @@
 #pragma once
 
 #include <cstdint>
+#ifdef _WIN32
 #include <Windows.h>
+#else
+#include "../Platform/LinuxCompat.h"
+#endif
 
 #include "../CrashDump/CrashDump.h"
 
@@ -161,7 +165,11 @@ private:
 
         ::GetSystemInfo(&systemInfo);
 
+#ifdef _WIN32
         CrashDump::Assert(systemInfo.lpMaximumApplicationAddress == (LPVOID)0x0000'7FFF'FFFE'FFFF);
+#else
+        CrashDump::Assert((uint64_t)systemInfo.lpMaximumApplicationAddress <= PURE_POINTER_MASK);
+#endif
     }
 
     //  ּ    (ID Ʈ )
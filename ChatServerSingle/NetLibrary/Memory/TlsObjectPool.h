@@ -11,7 +11,11 @@
 #pragma once
 
 #include <cstdint>
+#ifdef _WIN32
 #include <Windows.h>
+#else
+#include "../Platform/LinuxCompat.h"
+#endif
 
 #include "ObjectPool.h"
 #include "../CrashDump/CrashDump.h"
@@ -24,6 +28,7 @@ public:
     inline static uint32_t  GetObjectPerChunkCount(void) { return OBJECT_COUNT_PER_CHUNK; }
     inline static uint32_t  GetTotalChunkCount(void) { return mPoolManager.mChunkTotalCount; }
     inline static uint32_t  GetTotalCreatedObjectCount(void) { return mPoolManager.mChunkTotalCount * OBJECT_COUNT_PER_CHUNK; }
+    inline static uint32_t  GetChunkInManagerCount(void) { return mPoolManager.mChunkInManagerCount; }   //  嵵   ûũ 
 
     // ̸ ûũ  ´
     static void PreCreateChunk(uint32_t chunkCount)
@@ -0,0 +1,377 @@
+////////////////////////////////////////////////
+//  ۽(SetDeferredSend)   - ä   εĳƮ ʴ ۽ ޽ , ۽ ȣ ,  CPU  
+// Ŀ  Ŷ ؼ ۾ ť ְ, Ʈ  ϳ    ׷(GROUP ) ü SendPacket() Ѵ
+//  ۽̶ Ʈ 尡 ۾  ϳ ó  FlushSends() ȣѴ
+// Ŭ̾Ʈ fork() ڽ μ -  SESSIONS ΰ ü RATE msg/s ư ,  ޱ⸸ Ѵ
+//  CPU  Ŭ̾Ʈ  ʴ´ ( ӽ̹Ƿ ھ  )
+// Ʈ  ʴ ܵ  , Linux 
+//
+//  (io_uring -DIO_ENGINE_USE_TYPE=2 ߰)
+//   g++ -std=c++17 -O2 -I../.. DeferredSendBench.cpp NetServer.cpp Session.cpp IoUring.cpp MirroredRingBuffer.cpp IpConnectionTable.cpp
+//       ../Platform/LinuxCompat.cpp ../Logger/Logger.cpp ../CrashDump/CrashDump.cpp ../Profiler/Profiler.cpp -o DeferredSendBench -lpthread
+// 
+//   ./DeferredSendBench PORT SECONDS DEFERRED(0/1) [SESSIONS=15000] [GROUP=100] [RATE=1500]
+////////////////////////////////////////////////
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "NetServer.h"
+#include "PacketView.h"
+
+namespace
+{
+    constexpr uint32_t CHAT_PAYLOAD_SIZE = 60;
+
+    ////////////////////////////////////////////////
+    //  Ŷ ׷쿡 εĳƮϴ 
+    ////////////////////////////////////////////////
+    class BroadcastServer : public NetServer
+    {
+    public:
+        uint32_t GroupSize = 100;
+        bool bIsDeferred = false;
+
+        void RunUpdateThread(void)
+        {
+            std::vector<uint64_t> sessionIDs;
+            std::unordered_map<uint64_t, size_t> sessionIndexes;
+            std::deque<Work> batch;
+
+            while (true)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(mWorkLock);
+                    mWorkSignal.wait_for(lock, std::chrono::milliseconds(50), [this]() { return !mWorkQueue.empty() || !mbIsRunning; });
+
+                    if (false == mbIsRunning)
+                    {
+                        break;
+                    }
+
+                    batch.swap(mWorkQueue);
+                }
+
+                for (Work& work : batch)
+                {
+                    processWork(work, sessionIDs, sessionIndexes);
+                }
+
+                batch.clear();
+
+                // ̹  SendPacket()  ǵ ۽   Ǵ
+                if (bIsDeferred)
+                {
+                    FlushSends();
+                }
+            }
+
+            for (Work& work : mWorkQueue)
+            {
+                if (work.Packet != nullptr)
+                {
+                    Serializer::Free(work.Packet);
+                }
+            }
+        }
+
+        void StopUpdateThread(void)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mWorkLock);
+                mbIsRunning = false;
+            }
+
+            mWorkSignal.notify_all();
+        }
+
+    private:
+        enum class EWorkType
+        {
+            Accept,
+            Receive,
+            Release,
+        };
+
+        struct Work
+        {
+            EWorkType Type;
+            uint64_t SessionID;
+            Serializer* Packet;
+        };
+
+        void OnAccept(const uint64_t sessionID) override { pushWork({ EWorkType::Accept, sessionID, nullptr }); }
+        void OnReceive(const uint64_t sessionID, PacketView& packet) override { pushWork({ EWorkType::Receive, sessionID, packet.Clone() }); }
+        void OnRelease(const uint64_t sessionID) override { pushWork({ EWorkType::Release, sessionID, nullptr }); }
+
+        void pushWork(const Work& work)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mWorkLock);
+                mWorkQueue.push_back(work);
+            }
+
+            mWorkSignal.notify_one();
+        }
+
+        //    GroupSize  ׷ (ä  ֺ  )
+        void processWork(const Work& work, std::vector<uint64_t>& sessionIDs, std::unordered_map<uint64_t, size_t>& sessionIndexes)
+        {
+            switch (work.Type)
+            {
+            case EWorkType::Accept:
+                sessionIndexes[work.SessionID] = sessionIDs.size();
+                sessionIDs.push_back(work.SessionID);
+                break;
+            case EWorkType::Release:
+            {
+                auto iter = sessionIndexes.find(work.SessionID);
+                if (iter != sessionIndexes.end())
+                {
+                    size_t index = iter->second;
+                    sessionIDs[index] = sessionIDs.back();
+                    sessionIndexes[sessionIDs[index]] = index;
+                    sessionIDs.pop_back();
+                    sessionIndexes.erase(work.SessionID);
+                }
+                break;
+            }
+            case EWorkType::Receive:
+            {
+                auto iter = sessionIndexes.find(work.SessionID);
+                if (iter != sessionIndexes.end())
+                {
+                    Serializer* broadcastPacket = Serializer::Alloc(work.Packet->GetUseSize());
+                    broadcastPacket->InsertByte(work.Packet->GetUserBufferPointer(), work.Packet->GetUseSize());
+
+                    size_t groupStart = iter->second / GroupSize * GroupSize;
+                    for (size_t i = groupStart; i < groupStart + GroupSize && i < sessionIDs.size(); ++i)
+                    {
+                        SendPacket(sessionIDs[i], broadcastPacket);
+                    }
+
+                    Serializer::Free(broadcastPacket);
+                }
+
+                Serializer::Free(work.Packet);
+                break;
+            }
+            }
+        }
+
+        std::mutex mWorkLock;
+        std::condition_variable mWorkSignal;
+        std::deque<Work> mWorkQueue;
+        bool mbIsRunning = true;
+    };
+
+    // NET  + ü ȣȭ ڵ ä ũ Ŷ (RandKey )
+    std::vector<unsigned char> makeEncodedPacket(const uint32_t payloadSize)
+    {
+        const unsigned char randKey = 0x11;
+
+        std::vector<unsigned char> plain;
+        plain.push_back(0);
+
+        uint32_t checkSum = 0;
+        for (uint32_t i = 0; i < payloadSize; ++i)
+        {
+            plain.push_back(static_cast<unsigned char>(i * 7));
+            checkSum += static_cast<unsigned char>(i * 7);
+        }
+        plain[0] = static_cast<unsigned char>(checkSum);
+
+        std::vector<unsigned char> packet = { NETWORK_HEADER_CODE, static_cast<unsigned char>(payloadSize), static_cast<unsigned char>(payloadSize >> 8), randKey };
+
+        unsigned char prevRandValue = 0;
+        unsigned char prevEncodedValue = 0;
+        for (uint32_t i = 0; i < plain.size(); ++i)
+        {
+            prevRandValue = plain[i] ^ static_cast<unsigned char>(prevRandValue + randKey + i + 1);
+            prevEncodedValue = prevRandValue ^ static_cast<unsigned char>(prevEncodedValue + NETWORK_HEADER_FIXED_KEY + i + 1);
+            packet.push_back(prevEncodedValue);
+        }
+
+        return packet;
+    }
+
+    // ڽ μ - sessionCount , ü rate msg/s ư    
+    int runClient(const uint16_t port, const uint32_t sessionCount, const uint32_t rate, const uint32_t seconds)
+    {
+        const std::vector<unsigned char> packet = makeEncodedPacket(CHAT_PAYLOAD_SIZE);
+
+        int epollHandle = ::epoll_create1(0);
+        std::vector<int> sockets;
+
+        sockaddr_in serverAddress{};
+        serverAddress.sin_family = AF_INET;
+        serverAddress.sin_port = htons(port);
+        serverAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        for (uint32_t i = 0; i < sessionCount; ++i)
+        {
+            int sock = ::socket(AF_INET, SOCK_STREAM, 0);
+
+            //   ϱ ̶  ٷȴٰ ٽ õѴ
+            int retryCount = 0;
+            while (::connect(sock, reinterpret_cast<sockaddr*>(&serverAddress), sizeof(serverAddress)) != 0)
+            {
+                if (++retryCount > 100)
+                {
+                    perror("connect");
+                    return 1;
+                }
+
+                ::close(sock);
+                sock = ::socket(AF_INET, SOCK_STREAM, 0);
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+
+            int optionValue = 1;
+            ::setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &optionValue, sizeof(optionValue));
+            ::fcntl(sock, F_SETFL, O_NONBLOCK);
+
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u32 = i;
+            ::epoll_ctl(epollHandle, EPOLL_CTL_ADD, sock, &event);
+
+            sockets.push_back(sock);
+        }
+
+        //    ׷쿡    ٸ
+        std::this_thread::sleep_for(std::chrono::milliseconds(1'500));
+
+        static char recvBuffer[65536];
+        epoll_event events[512];
+        uint64_t sentCount = 0;
+        uint32_t nextSocket = 0;
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        while (true)
+        {
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+            if (elapsed > seconds)
+            {
+                break;
+            }
+
+            //  ǳʶٸ鼭  -  ׷쿡  ʵ
+            uint64_t targetCount = static_cast<uint64_t>(elapsed * rate);
+            while (sentCount < targetCount)
+            {
+                ::send(sockets[nextSocket], packet.data(), packet.size(), 0);
+                nextSocket = (nextSocket + 97) % sessionCount;
+                sentCount++;
+            }
+
+            int eventCount = ::epoll_wait(epollHandle, events, 512, 1);
+            for (int i = 0; i < eventCount; ++i)
+            {
+                while (::recv(sockets[events[i].data.u32], recvBuffer, sizeof(recvBuffer), 0) > 0)
+                {
+                }
+            }
+        }
+
+        for (int sock : sockets)
+        {
+            ::close(sock);
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 4)
+    {
+        wprintf(L"usage: %hs PORT SECONDS DEFERRED(0/1) [SESSIONS=15000] [GROUP=100] [RATE=1500]\n", argv[0]);
+        return 1;
+    }
+
+    const uint16_t port = static_cast<uint16_t>(atoi(argv[1]));
+    const uint32_t seconds = static_cast<uint32_t>(atoi(argv[2]));
+    const bool bIsDeferred = atoi(argv[3]) != 0;
+    const uint32_t sessionCount = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 15'000;
+    const uint32_t groupSize = argc > 5 ? static_cast<uint32_t>(atoi(argv[5])) : 100;
+    const uint32_t rate = argc > 6 ? static_cast<uint32_t>(atoi(argv[6])) : 1'500;
+
+    //  Ŭ̾Ʈ   ŭ  
+    rlimit fileLimit;
+    ::getrlimit(RLIMIT_NOFILE, &fileLimit);
+    fileLimit.rlim_cur = fileLimit.rlim_max;
+    ::setrlimit(RLIMIT_NOFILE, &fileLimit);
+
+    //  尡   Ŭ̾Ʈ  (Ŭ̾Ʈ ð   +  ð + )
+    pid_t clientPid = ::fork();
+    if (clientPid == 0)
+    {
+        return runClient(port, sessionCount, rate, seconds + 2);
+    }
+
+    BroadcastServer server;
+    server.GroupSize = groupSize;
+    server.bIsDeferred = bIsDeferred;
+    server.SetTcpNodelay(true);
+    server.SetDeferredSend(bIsDeferred);
+    server.Start(port, sessionCount + 1'000, 4, 4);
+
+    std::thread updateThread([&server]() { server.RunUpdateThread(); });
+
+    // Ŭ̾Ʈ     ٸ
+    while (server.GetSessionCount() < sessionCount)
+    {
+        ::Sleep(100);
+    }
+
+    ::Sleep(1'500);
+
+    //  1ʴ   ճ
+    uint64_t sendMessageSum = 0;
+    uint64_t sendCallSum = 0;
+    double processTimeSum = 0;
+    uint32_t sampleCount = 0;
+
+    for (uint32_t second = 0; second < seconds; ++second)
+    {
+        ::Sleep(1'000);
+
+        MonitoringVariables monitoringInfo = server.GetMonitoringInfo();
+        wprintf(L"sessions %u  recv %u/s  send %u/s  send calls %u/s  cpu %.1f%%\n",
+            server.GetSessionCount(), monitoringInfo.RecvMessageTPS, monitoringInfo.SendMessageTPS, monitoringInfo.SendCallTPS, monitoringInfo.ProcessTimeTotal);
+
+        if (second > 0)
+        {
+            sendMessageSum += monitoringInfo.SendMessageTPS;
+            sendCallSum += monitoringInfo.SendCallTPS;
+            processTimeSum += monitoringInfo.ProcessTimeTotal;
+            sampleCount++;
+        }
+    }
+
+    if (sampleCount > 0)
+    {
+        wprintf(L"RESULT %ls sessions %u group %u rate %u : send %llu/s  send calls %llu/s  cpu %.1f%%\n",
+            bIsDeferred ? L"deferred" : L"immediate", sessionCount, groupSize, rate,
+            sendMessageSum / sampleCount, sendCallSum / sampleCount, processTimeSum / sampleCount);
+    }
+
+    ::waitpid(clientPid, nullptr, 0);
+
+    server.StopUpdateThread();
+    updateThread.join();
+    server.Shutdown();
+
+    return 0;
+}
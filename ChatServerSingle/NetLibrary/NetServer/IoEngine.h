@@ -0,0 +1,23 @@
+#pragma once
+
+#define IO_ENGINE_TYPE_IOCP  0 // Windows IOCP : WSARecv/WSASend Ϸ 
+#define IO_ENGINE_TYPE_EPOLL 1 // Linux epoll : edge-triggered غ  + ŷ read/writev
+#define IO_ENGINE_TYPE_URING 2 // Linux io_uring : multishot recv + provided buffer Ϸ 
+
+#ifndef IO_ENGINE_USE_TYPE
+
+#ifdef _WIN32
+#define IO_ENGINE_USE_TYPE IO_ENGINE_TYPE_IOCP
+#else
+#define IO_ENGINE_USE_TYPE IO_ENGINE_TYPE_EPOLL
+#endif
+
+#endif
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP && !defined(_WIN32)
+static_assert(false, "IOCP engine is available only on Windows");
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL && defined(_WIN32)
+static_assert(false, "epoll engine is available only on Linux");
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING && defined(_WIN32)
+static_assert(false, "io_uring engine is available only on Linux");
+#endif
@@ -0,0 +1,329 @@
+#include "IoUring.h"
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+
+#include <sys/mman.h>
+
+#include "../Logger/Logger.h"
+
+void IoUring::Init(const uint32_t entryCount, const uint32_t providedBufferCount, const uint32_t providedBufferSize)
+{
+    ASSERT_LIVE(providedBufferCount <= UINT16_MAX, L"IoUring providedBufferCount too large");
+
+    InitializeSRWLock(&mSubmitLock);
+
+    // multishot recv Ϸᰡ   Ƿ CQ ˳ ´
+    io_uring_params params{};
+    params.flags = IORING_SETUP_CQSIZE;
+    params.cq_entries = entryCount * 4;
+
+    mRingFd = static_cast<int>(::syscall(__NR_io_uring_setup, entryCount, &params));
+    ASSERT_LIVE(mRingFd != -1, L"io_uring_setup() failed");
+
+    /********************************* SQ, CQ mmap *********************************/
+
+    mSqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    mCqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        if (mCqRingSize > mSqRingSize)
+        {
+            mSqRingSize = mCqRingSize;
+        }
+        mCqRingSize = mSqRingSize;
+    }
+
+    mSqRing = ::mmap(nullptr, mSqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQ_RING);
+    ASSERT_LIVE(mSqRing != MAP_FAILED, L"io_uring SQ ring mmap() failed");
+
+    if (params.features & IORING_FEAT_SINGLE_MMAP)
+    {
+        mCqRing = mSqRing;
+    }
+    else
+    {
+        mCqRing = ::mmap(nullptr, mCqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_CQ_RING);
+        ASSERT_LIVE(mCqRing != MAP_FAILED, L"io_uring CQ ring mmap() failed");
+    }
+
+    mSqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    mSqes = reinterpret_cast<io_uring_sqe*>(::mmap(nullptr, mSqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, mRingFd, IORING_OFF_SQES));
+    ASSERT_LIVE(mSqes != MAP_FAILED, L"io_uring SQEs mmap() failed");
+
+    char* sqRing = reinterpret_cast<char*>(mSqRing);
+    mSqHead = reinterpret_cast<uint32_t*>(sqRing + params.sq_off.head);
+    mSqTail = reinterpret_cast<uint32_t*>(sqRing + params.sq_off.tail);
+    mSqMask = *reinterpret_cast<uint32_t*>(sqRing + params.sq_off.ring_mask);
+    mSqEntryCount = params.sq_entries;
+
+    // SQ 迭 ׻  ε Ű Ѵ
+    uint32_t* sqArray = reinterpret_cast<uint32_t*>(sqRing + params.sq_off.array);
+    for (uint32_t i = 0; i < mSqEntryCount; ++i)
+    {
+        sqArray[i] = i;
+    }
+
+    char* cqRing = reinterpret_cast<char*>(mCqRing);
+    mCqHead = reinterpret_cast<uint32_t*>(cqRing + params.cq_off.head);
+    mCqTail = reinterpret_cast<uint32_t*>(cqRing + params.cq_off.tail);
+    mCqMask = *reinterpret_cast<uint32_t*>(cqRing + params.cq_off.ring_mask);
+    mCqes = reinterpret_cast<io_uring_cqe*>(cqRing + params.cq_off.cqes);
+
+    /********************************* provided buffer *********************************/
+
+    //   SQE Ѵ - Ϸ    ´
+    mProvidedBufferSize = providedBufferSize;
+    mProvidedBuffers = new char[static_cast<size_t>(providedBufferCount) * providedBufferSize];
+
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_PROVIDE_BUFFERS;
+    sqe.fd = static_cast<int>(providedBufferCount);
+    sqe.addr = reinterpret_cast<uint64_t>(mProvidedBuffers);
+    sqe.len = mProvidedBufferSize;
+    sqe.off = 0;
+    sqe.buf_group = PROVIDED_BUFFER_GROUP_ID;
+    sqe.flags = IOSQE_CQE_SKIP_SUCCESS;
+    sqe.user_data = MakeUserData(nullptr, EIoUringOperation::ProvideBuffer);
+
+    pushSqe(sqe);
+}
+
+void IoUring::Release(void)
+{
+    if (mRingFd == -1)
+    {
+        return;
+    }
+
+    ::munmap(mSqes, mSqesSize);
+
+    if (mCqRing != mSqRing)
+    {
+        ::munmap(mCqRing, mCqRingSize);
+    }
+    ::munmap(mSqRing, mSqRingSize);
+
+    //  fd  provided buffer,   ϵ ȴ
+    ::close(mRingFd);
+    mRingFd = -1;
+
+    delete[] mProvidedBuffers;
+    mProvidedBuffers = nullptr;
+
+    mFixedBufferCount = 0;
+}
+
+void IoUring::PrepareRecvMultishot(const SOCKET socket, const void* context)
+{
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_RECV;
+    sqe.fd = static_cast<int>(socket);
+    sqe.ioprio = IORING_RECV_MULTISHOT;
+    sqe.flags = IOSQE_BUFFER_SELECT;
+    sqe.buf_group = PROVIDED_BUFFER_GROUP_ID;
+    sqe.user_data = MakeUserData(context, EIoUringOperation::Recv);
+
+    pushSqe(sqe);
+}
+
+void IoUring::PrepareSendMessage(const SOCKET socket, const msghdr* message, const void* context)
+{
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_SENDMSG;
+    sqe.fd = static_cast<int>(socket);
+    sqe.addr = reinterpret_cast<uint64_t>(message);
+    sqe.len = 1;
+    sqe.msg_flags = MSG_NOSIGNAL;
+    sqe.user_data = MakeUserData(context, EIoUringOperation::Send);
+
+    pushSqe(sqe);
+}
+
+void IoUring::PrepareWriteFixed(const SOCKET socket, const void* buffer, const uint32_t length, const uint16_t bufferIndex, const void* context)
+{
+    //    ʴ´ (0̾ ), SIGPIPE WSAStartup() ϵ صξ
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_WRITE_FIXED;
+    sqe.fd = static_cast<int>(socket);
+    sqe.addr = reinterpret_cast<uint64_t>(buffer);
+    sqe.len = length;
+    sqe.off = 0;
+    sqe.buf_index = bufferIndex;
+    sqe.user_data = MakeUserData(context, EIoUringOperation::Send);
+
+    pushSqe(sqe);
+}
+
+void IoUring::PrepareNotify(void)
+{
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_NOP;
+    sqe.user_data = MakeUserData(nullptr, EIoUringOperation::Notify);
+
+    pushSqe(sqe);
+}
+
+void IoUring::SubmitAndWait(const uint32_t waitCount)
+{
+    enter(waitCount);
+}
+
+bool IoUring::TryPopCompletion(io_uring_cqe* outCompletion)
+{
+    for (;;)
+    {
+        uint32_t head = *mCqHead;
+        uint32_t tail = __atomic_load_n(mCqTail, __ATOMIC_ACQUIRE);
+
+        if (head == tail)
+        {
+            return false;
+        }
+
+        *outCompletion = mCqes[head & mCqMask];
+
+        __atomic_store_n(mCqHead, head + 1, __ATOMIC_RELEASE);
+
+        if (GetOperation(outCompletion->user_data) != EIoUringOperation::ProvideBuffer)
+        {
+            return true;
+        }
+
+        //  ȯ  - ۰ ϳ پ ä  Ѵ
+        LOGF(ELogLevel::Error, L"io_uring provide buffer failed (errorCode = %d)", -outCompletion->res);
+    }
+}
+
+void IoUring::RecycleProvidedBuffer(const uint16_t bufferID)
+{
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_PROVIDE_BUFFERS;
+    sqe.fd = 1;
+    sqe.addr = reinterpret_cast<uint64_t>(GetProvidedBuffer(bufferID));
+    sqe.len = mProvidedBufferSize;
+    sqe.off = bufferID;
+    sqe.buf_group = PROVIDED_BUFFER_GROUP_ID;
+    sqe.flags = IOSQE_CQE_SKIP_SUCCESS;
+    sqe.user_data = MakeUserData(nullptr, EIoUringOperation::ProvideBuffer);
+
+    pushSqe(sqe);
+}
+
+bool IoUring::InitFixedBuffers(const uint32_t bufferCount)
+{
+    // ĭ  ä ̺ , ۴   RegisterFixedBuffer() ä
+    io_uring_rsrc_register registerArgument{};
+    registerArgument.nr = bufferCount;
+    registerArgument.flags = IORING_RSRC_REGISTER_SPARSE;
+
+    int retRegister = static_cast<int>(::syscall(__NR_io_uring_register, mRingFd, IORING_REGISTER_BUFFERS2, &registerArgument, sizeof(registerArgument)));
+
+    if (retRegister < 0)
+    {
+        LOGF(ELogLevel::System, L"io_uring register buffers failed (errno = %d) - send without fixed buffers", errno);
+        return false;
+    }
+
+    mFixedBufferCount = bufferCount;
+
+    return true;
+}
+
+bool IoUring::RegisterFixedBuffer(const uint32_t bufferIndex, void* buffer, const size_t size)
+{
+    if (bufferIndex >= mFixedBufferCount)
+    {
+        return false;
+    }
+
+    iovec bufferIov{ buffer, size };
+
+    io_uring_rsrc_update2 updateArgument{};
+    updateArgument.offset = bufferIndex;
+    updateArgument.data = reinterpret_cast<uint64_t>(&bufferIov);
+    updateArgument.nr = 1;
+
+    int retRegister = static_cast<int>(::syscall(__NR_io_uring_register, mRingFd, IORING_REGISTER_BUFFERS_UPDATE, &updateArgument, sizeof(updateArgument)));
+
+    if (retRegister < 0)
+    {
+        LOGF(ELogLevel::System, L"io_uring register fixed buffer %u failed (errno = %d) - send without fixed buffers", bufferIndex, errno);
+        return false;
+    }
+
+    return true;
+}
+
+void IoUring::UnregisterFixedBuffer(const uint32_t bufferIndex)
+{
+    //  iovec ϸ ĭ  (  write     ۸  ִ)
+    RegisterFixedBuffer(bufferIndex, nullptr, 0);
+}
+
+void IoUring::pushSqe(const io_uring_sqe& sqe)
+{
+    for (;;)
+    {
+        AcquireSRWLockExclusive(&mSubmitLock);
+
+        uint32_t tail = *mSqTail;
+        uint32_t head = __atomic_load_n(mSqHead, __ATOMIC_ACQUIRE);
+
+        if (tail - head < mSqEntryCount)
+        {
+            mSqes[tail & mSqMask] = sqe;
+            __atomic_store_n(mSqTail, tail + 1, __ATOMIC_RELEASE);
+
+            ReleaseSRWLockExclusive(&mSubmitLock);
+            break;
+        }
+
+        ReleaseSRWLockExclusive(&mSubmitLock);
+
+        // SQ   -  ϰ ٽ õ
+        enter(0);
+    }
+
+    //  Ŀ   SubmitAndWait() Ƽ Ѵ
+    if (l_ownerRing != this)
+    {
+        enter(0);
+    }
+}
+
+void IoUring::enter(const uint32_t waitCount)
+{
+    uint32_t flags = waitCount > 0 ? IORING_ENTER_GETEVENTS : 0;
+
+    for (;;)
+    {
+        // to_submit    ٸ Ŀ  ʰ ٷ ϹǷ  ŭ ѱ
+        // ٸ 尡    ߴٸ   ϵ ̴
+        uint32_t submitCount = __atomic_load_n(mSqTail, __ATOMIC_ACQUIRE) - __atomic_load_n(mSqHead, __ATOMIC_ACQUIRE);
+
+        int retEnter = static_cast<int>(::syscall(__NR_io_uring_enter, mRingFd, submitCount, waitCount, flags, nullptr, 0));
+
+        if (retEnter >= 0)
+        {
+            return;
+        }
+
+        int errorCode = errno;
+        switch (errorCode)
+        {
+        case EINTR:
+            continue;
+        case EAGAIN:
+        case EBUSY:
+            // CQ   ̷ - Ŀ ϷḦ   ٽ ȴ
+            return;
+        default:
+            LOGF(ELogLevel::Error, L"io_uring_enter() failed (errno = %d)", errorCode);
+            Logger::RaiseCrash();
+            return;
+        }
+    }
+}
+
+#endif
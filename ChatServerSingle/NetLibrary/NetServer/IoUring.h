@@ -0,0 +1,139 @@
+#pragma once
+
+#include "IoEngine.h"
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+
+#include <linux/io_uring.h>
+#include <sys/socket.h>
+
+#include "../Platform/LinuxCompat.h"
+
+// Ϸ (user_data)  3Ʈ ۾ ,  ؽƮ  (8Ʈ )
+enum class EIoUringOperation : uint64_t
+{
+    Recv = 1,
+    Send = 2,
+    Notify = 3,         // ؽƮ  -  û,  (PQCS )
+    ProvideBuffer = 4,  // ؽƮ  -   Ǹ TryPopCompletion() ɷ
+};
+
+////////////////////////////////////////////////
+// io_uring  ϳ  Ŭ (liburing  ý   )
+// SQ :  尡 ä  ִ (SRWLOCK)
+// CQ, provided buffer :  Ŀ 常 ٷ
+//   (registered buffer) : ۽   θ write  Ŀ   ʴ´
+//  Ŀ 尡 ä SQE( ȯ, recv , send)  SubmitAndWait()   ȴ
+////////////////////////////////////////////////
+class IoUring final
+{
+public:
+    IoUring(void) = default;
+    ~IoUring(void) { Release(); }
+
+    IoUring(const IoUring& other) = delete;
+    IoUring& operator=(const IoUring& other) = delete;
+
+    //    provided buffer 
+    void Init(const uint32_t entryCount, const uint32_t providedBufferCount, const uint32_t providedBufferSize);
+
+    //  
+    void Release(void);
+
+    // ȣ 带    Ŀ Ѵ
+    inline void BindOwnerThread(void) { l_ownerRing = this; }
+
+public: // SQE ߰
+
+    // multishot recv - provided buffer ۸   Ѵ
+    void PrepareRecvMultishot(const SOCKET socket, const void* context);
+
+    // sendmsg - message Ϸ     ȿؾ Ѵ
+    void PrepareSendMessage(const SOCKET socket, const msghdr* message, const void* context);
+
+    // write - buffer bufferIndex ĭ ϵ   ̾ ϰ, Ϸ     ȿؾ Ѵ
+    void PrepareWriteFixed(const SOCKET socket, const void* buffer, const uint32_t length, const uint16_t bufferIndex, const void* context);
+
+    // nop - Notify Ϸ  
+    void PrepareNotify(void);
+
+public: // , Ϸ
+
+    // Ƶ SQE ϰ waitCount ̻ Ϸᰡ    
+    void SubmitAndWait(const uint32_t waitCount);
+
+    // Ϸ  ϳ , ٸ false
+    bool TryPopCompletion(io_uring_cqe* outCompletion);
+
+    inline static uint64_t          MakeUserData(const void* context, const EIoUringOperation operation) { return reinterpret_cast<uint64_t>(context) | static_cast<uint64_t>(operation); }
+    inline static EIoUringOperation GetOperation(const uint64_t userData) { return static_cast<EIoUringOperation>(userData & USER_DATA_OPERATION_MASK); }
+    inline static void*             GetContext(const uint64_t userData) { return reinterpret_cast<void*>(userData & ~USER_DATA_OPERATION_MASK); }
+
+public: // provided buffer
+
+    inline char* GetProvidedBuffer(const uint16_t bufferID) const { return mProvidedBuffers + static_cast<size_t>(bufferID) * mProvidedBufferSize; }
+
+    //   ۸ Ŀο ش ( Ŀ 常 ȣ,    ݿ)
+    void RecycleProvidedBuffer(const uint16_t bufferID);
+
+public: //  
+
+    // bufferCountĭ    ̺ Ѵ, ߴٸ (Ŀ  ) false -    Ѵ
+    bool InitFixedBuffers(const uint32_t bufferCount);
+
+    // bufferIndex ĭ buffer Ѵ (ƹ 峪 ȣ ), ߴٸ (޸  ѵ ) false
+    bool RegisterFixedBuffer(const uint32_t bufferIndex, void* buffer, const size_t size);
+
+    // bufferIndex ĭ 
+    void UnregisterFixedBuffer(const uint32_t bufferIndex);
+
+private:
+
+    // SQE SQ Ѵ,  Ŀ 尡 ƴ϶ ٷ 
+    void pushSqe(const io_uring_sqe& sqe);
+
+    // io_uring_enter()
+    void enter(const uint32_t waitCount);
+
+private:
+
+    enum
+    {
+        USER_DATA_OPERATION_MASK = 0x7,
+        PROVIDED_BUFFER_GROUP_ID = 0
+    };
+
+    int                 mRingFd = -1;
+
+    // SQ
+    SRWLOCK             mSubmitLock;
+    uint32_t*           mSqHead;
+    uint32_t*           mSqTail;
+    uint32_t            mSqMask;
+    uint32_t            mSqEntryCount;
+    io_uring_sqe*       mSqes;
+
+    // CQ
+    uint32_t*           mCqHead;
+    uint32_t*           mCqTail;
+    uint32_t            mCqMask;
+    io_uring_cqe*       mCqes;
+
+    // mmap 
+    void*               mSqRing;
+    size_t              mSqRingSize;
+    void*               mCqRing;
+    size_t              mCqRingSize;
+    size_t              mSqesSize;
+
+    // provided buffer
+    char*               mProvidedBuffers;
+    uint32_t            mProvidedBufferSize;
+
+    //  
+    uint32_t            mFixedBufferCount = 0;
+
+    inline static thread_local IoUring* l_ownerRing = nullptr;
+};
+
+#endif
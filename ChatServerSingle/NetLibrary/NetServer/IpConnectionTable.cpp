@@ -0,0 +1,167 @@
+#include "IpConnectionTable.h"
+
+void IpConnectionTable::Init(const uint32_t capacity)
+{
+    uint32_t entryCount = 1;
+    while (entryCount < capacity)
+    {
+        entryCount <<= 1;
+    }
+
+    mEntries = new Entry[entryCount]{};
+    mMask = entryCount - 1;
+
+    ::InitializeSRWLock(&mClaimLock);
+}
+
+void IpConnectionTable::Release(void)
+{
+    delete[] mEntries;
+    mEntries = nullptr;
+    mMask = 0;
+}
+
+IpConnectionTable::EResult IpConnectionTable::TryAddConnection(const uint32_t ip, const uint32_t currentTick, const uint32_t maxConnectionCount, const uint32_t maxConnectCountPerSecond)
+{
+    const uint32_t homeIndex = getHomeIndex(ip);
+
+    for (;;)
+    {
+        Entry* freeEntry = nullptr;
+        const uint32_t probe = findIp(ip, homeIndex, MAX_PROBE_COUNT, currentTick, freeEntry);
+
+        if (probe == MAX_PROBE_COUNT)
+        {
+            if (freeEntry == nullptr)
+            {
+                return EResult::Untracked;
+            }
+
+            //  IP -  ȿ ٽ ãƼ  ̿ ٸ Accept 尡  IP  ʾ   Կ IP ´
+            //    ( Կ  IP  Դٸ) ó ٽ ã´
+            ::AcquireSRWLockExclusive(&mClaimLock);
+
+            freeEntry = nullptr;
+
+            if (findIp(ip, homeIndex, MAX_PROBE_COUNT, currentTick, freeEntry) == MAX_PROBE_COUNT && freeEntry != nullptr)
+            {
+                uint64_t freeKey = freeEntry->Key;
+
+                if (getKeyIp(freeKey) == 0 || (getKeyConnectionCount(freeKey) == 0 && currentTick - getWindowStartTick(freeEntry->Window) >= RATE_WINDOW_MS))
+                {
+                    InterlockedCompareExchange64(reinterpret_cast<LONG64*>(&freeEntry->Key), makeKey(ip, 0), freeKey);
+                }
+            }
+
+            ::ReleaseSRWLockExclusive(&mClaimLock);
+
+            continue;
+        }
+
+        Entry& entry = mEntries[(homeIndex + probe) & mMask];
+
+        if (maxConnectCountPerSecond > 0 && false == tryCountConnect(entry, currentTick, maxConnectCountPerSecond))
+        {
+            return EResult::TooFrequent;
+        }
+
+        for (;;)
+        {
+            uint64_t key = entry.Key;
+
+            //   0̴  ٸ IP  - ó ٽ ã´
+            if (getKeyIp(key) != ip)
+            {
+                break;
+            }
+
+            if (maxConnectionCount > 0 && getKeyConnectionCount(key) >= maxConnectionCount)
+            {
+                return EResult::TooManyConnections;
+            }
+
+            if (static_cast<uint64_t>(InterlockedCompareExchange64(reinterpret_cast<LONG64*>(&entry.Key), makeKey(ip, getKeyConnectionCount(key) + 1), key)) == key)
+            {
+                return EResult::Accepted;
+            }
+
+            // ٸ 尡  ٲ -   ٽ Ȯ
+        }
+    }
+}
+
+void IpConnectionTable::RemoveConnection(const uint32_t ip)
+{
+    const uint32_t homeIndex = getHomeIndex(ip);
+
+    for (uint32_t probe = 0; probe < MAX_PROBE_COUNT; ++probe)
+    {
+        Entry& entry = mEntries[(homeIndex + probe) & mMask];
+
+        for (;;)
+        {
+            uint64_t key = entry.Key;
+
+            //   ִ  ٸ IP  Ƿ ݵ ã´
+            if (getKeyIp(key) != ip || getKeyConnectionCount(key) == 0)
+            {
+                break;
+            }
+
+            if (static_cast<uint64_t>(InterlockedCompareExchange64(reinterpret_cast<LONG64*>(&entry.Key), key - 1, key)) == key)
+            {
+                return;
+            }
+        }
+    }
+}
+
+uint32_t IpConnectionTable::findIp(const uint32_t ip, const uint32_t homeIndex, const uint32_t probeCount, const uint32_t currentTick, Entry*& outFreeEntry) const
+{
+    for (uint32_t probe = 0; probe < probeCount; ++probe)
+    {
+        Entry& entry = mEntries[(homeIndex + probe) & mMask];
+
+        uint64_t key = entry.Key;
+        uint32_t keyIp = getKeyIp(key);
+
+        if (keyIp == ip)
+        {
+            return probe;
+        }
+
+        // ְų,      - IP  ã   
+        if (outFreeEntry == nullptr && (keyIp == 0 || (getKeyConnectionCount(key) == 0 && currentTick - getWindowStartTick(entry.Window) >= RATE_WINDOW_MS)))
+        {
+            outFreeEntry = &entry;
+        }
+    }
+
+    return probeCount;
+}
+
+bool IpConnectionTable::tryCountConnect(Entry& entry, const uint32_t currentTick, const uint32_t maxConnectCountPerSecond)
+{
+    for (;;)
+    {
+        uint64_t window = entry.Window;
+        uint32_t startTick = getWindowStartTick(window);
+        uint32_t connectCount = getWindowConnectCount(window);
+
+        if (currentTick - startTick >= RATE_WINDOW_MS)
+        {
+            startTick = currentTick;
+            connectCount = 0;
+        }
+
+        if (connectCount >= maxConnectCountPerSecond)
+        {
+            return false;
+        }
+
+        if (static_cast<uint64_t>(InterlockedCompareExchange64(reinterpret_cast<LONG64*>(&entry.Window), makeWindow(startTick, connectCount + 1), window)) == window)
+        {
+            return true;
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include "../Platform/LinuxCompat.h"
+#endif
+
+////////////////////////////////////////////////
+// IP    ʴ  Ƚ  ؽ ̺ (Accept   ѿ)
+//  ּҹ( Ž) -  [IP 32bit][   32bit] [  ð 32bit][ õ Ƚ 32bit]  64Ʈ ϳ  CAS ϹǷ   а 
+//   ʴ´ -   ʴ  Ƚ    ٸ IP 
+// ̹ ִ IP   ,  IP mClaimLock ȿ ٽ ãƺ ڿ  Կ IP ´ (  0) -  IP  Կ   ʴ´
+////////////////////////////////////////////////
+class IpConnectionTable
+{
+public:
+    enum class EResult
+    {
+        Accepted,               //   (RemoveConnection() ʿ)
+        Untracked,              // ̺ ڸ   ʰ  (RemoveConnection() ʿ)
+        TooManyConnections,     //    ʰ
+        TooFrequent             // ʴ  Ƚ ʰ
+    };
+
+    IpConnectionTable(void) = default;
+    ~IpConnectionTable(void) { Release(); }
+
+    IpConnectionTable(const IpConnectionTable& other) = delete;
+    IpConnectionTable& operator=(const IpConnectionTable& other) = delete;
+
+    //   2 ŵ øȴ
+    void Init(const uint32_t capacity);
+    void Release(void);
+
+    inline bool IsInitialized(void) const { return mEntries != nullptr; }
+
+    // ѵ Ȯϰ ȴٸ    1 ø (ѵ 0̸ Ȯ )
+    EResult TryAddConnection(const uint32_t ip, const uint32_t currentTick, const uint32_t maxConnectionCount, const uint32_t maxConnectCountPerSecond);
+
+    // Accepted     ȣ
+    void RemoveConnection(const uint32_t ip);
+
+private:
+
+    enum
+    {
+        MAX_PROBE_COUNT = 16,       // ̸ŭ Žص ڸ ٸ Untracked
+        RATE_WINDOW_MS = 1'000
+    };
+
+    struct Entry
+    {
+        uint64_t    Key;                    // [IP 32bit][   32bit], IP 0̸  
+        uint64_t    Window;                 // [ʴ  Ƚ   ð 32bit][ ȿ  õ Ƚ 32bit]
+    };
+
+    static inline uint64_t makeKey(const uint32_t ip, const uint32_t connectionCount) { return (static_cast<uint64_t>(ip) << 32) | connectionCount; }
+    static inline uint32_t getKeyIp(const uint64_t key) { return static_cast<uint32_t>(key >> 32); }
+    static inline uint32_t getKeyConnectionCount(const uint64_t key) { return static_cast<uint32_t>(key); }
+
+    static inline uint64_t makeWindow(const uint32_t startTick, const uint32_t connectCount) { return (static_cast<uint64_t>(startTick) << 32) | connectCount; }
+    static inline uint32_t getWindowStartTick(const uint64_t window) { return static_cast<uint32_t>(window >> 32); }
+    static inline uint32_t getWindowConnectCount(const uint64_t window) { return static_cast<uint32_t>(window); }
+
+    // ip  ù  Ž  (probeCount ȿ ٸ probeCount), outFreeEntry  տ ó    ִ  (ٸ ״)
+    uint32_t findIp(const uint32_t ip, const uint32_t homeIndex, const uint32_t probeCount, const uint32_t currentTick, Entry*& outFreeEntry) const;
+
+    //    õ Ƚ 1 ø ( ٸ  ), ѵ Ѵ´ٸ ø ʰ false
+    static bool tryCountConnect(Entry& entry, const uint32_t currentTick, const uint32_t maxConnectCountPerSecond);
+
+    inline uint32_t getHomeIndex(uint32_t ip) const
+    {
+        ip ^= ip >> 16;
+        ip *= 0x45D9'F3B;
+        ip ^= ip >> 16;
+        return ip & mMask;
+    }
+
+private:
+    Entry*      mEntries = nullptr;
+    uint32_t    mMask = 0;
+    SRWLOCK     mClaimLock;     //  Կ  IP   ´ (  ͵  ̹Ƿ  )
+};
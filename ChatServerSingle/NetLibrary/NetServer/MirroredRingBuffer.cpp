@@ -0,0 +1,94 @@
+#pragma comment(lib, "onecore.lib")
+
+#include "MirroredRingBuffer.h"
+
+#ifdef _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+
+#include "../Platform/LinuxCompat.h"
+#endif
+
+#include "../Logger/Logger.h"
+
+//   -  °  ù °  ٷ ڿ  뷮    Ѵ
+static uint32_t getMappingGranularity(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO systemInfo;
+    ::GetSystemInfo(&systemInfo);
+    return systemInfo.dwAllocationGranularity;
+#else
+    return static_cast<uint32_t>(::sysconf(_SC_PAGESIZE));
+#endif
+}
+
+MirroredRingBuffer::MirroredRingBuffer(int bufferSize)
+{
+    // 2 ŵ ø - ġ  %  ŷ Ѵ
+    mCapacity = getMappingGranularity();
+    while (mCapacity < static_cast<uint32_t>(bufferSize))
+    {
+        mCapacity <<= 1;
+    }
+    mMask = mCapacity - 1;
+
+#ifdef _WIN32
+
+    // (placeholder)       üѴ
+    HANDLE section = ::CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, mCapacity, nullptr);
+    ASSERT_LIVE(section != nullptr, L"MirroredRingBuffer CreateFileMapping() failed");
+
+    char* placeholder = reinterpret_cast<char*>(::VirtualAlloc2(nullptr, nullptr, static_cast<SIZE_T>(mCapacity) * 2, MEM_RESERVE | MEM_RESERVE_PLACEHOLDER, PAGE_NOACCESS, nullptr, 0));
+    ASSERT_LIVE(placeholder != nullptr, L"MirroredRingBuffer VirtualAlloc2() failed");
+
+    BOOL retSplit = ::VirtualFree(placeholder, mCapacity, MEM_RELEASE | MEM_PRESERVE_PLACEHOLDER);
+    ASSERT_LIVE(retSplit != FALSE, L"MirroredRingBuffer placeholder split failed");
+
+    void* firstView = ::MapViewOfFile3(section, nullptr, placeholder, 0, mCapacity, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+    ASSERT_LIVE(firstView != nullptr, L"MirroredRingBuffer first MapViewOfFile3() failed");
+
+    void* secondView = ::MapViewOfFile3(section, nullptr, placeholder + mCapacity, 0, mCapacity, MEM_REPLACE_PLACEHOLDER, PAGE_READWRITE, nullptr, 0);
+    ASSERT_LIVE(secondView != nullptr, L"MirroredRingBuffer second MapViewOfFile3() failed");
+
+    // 䰡  ϰ Ƿ ڵ ٷ ݴ´
+    ::CloseHandle(section);
+
+    mBuffer = placeholder;
+
+#else
+
+    int memoryFd = ::memfd_create("MirroredRingBuffer", MFD_CLOEXEC);
+    ASSERT_LIVE(memoryFd != -1, L"MirroredRingBuffer memfd_create() failed");
+
+    int retTruncate = ::ftruncate(memoryFd, mCapacity);
+    ASSERT_LIVE(retTruncate == 0, L"MirroredRingBuffer ftruncate() failed");
+
+    // ӵ ּҸ  ϰ        Ѵ
+    char* reserved = reinterpret_cast<char*>(::mmap(nullptr, static_cast<size_t>(mCapacity) * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    ASSERT_LIVE(reserved != MAP_FAILED, L"MirroredRingBuffer reserve mmap() failed");
+
+    void* firstView = ::mmap(reserved, mCapacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, memoryFd, 0);
+    ASSERT_LIVE(firstView != MAP_FAILED, L"MirroredRingBuffer first mmap() failed");
+
+    void* secondView = ::mmap(reserved + mCapacity, mCapacity, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, memoryFd, 0);
+    ASSERT_LIVE(secondView != MAP_FAILED, L"MirroredRingBuffer second mmap() failed");
+
+    //   ϰ Ƿ fd ٷ ݴ´
+    ::close(memoryFd);
+
+    mBuffer = reserved;
+
+#endif
+}
+
+MirroredRingBuffer::~MirroredRingBuffer()
+{
+#ifdef _WIN32
+    ::UnmapViewOfFile(mBuffer);
+    ::UnmapViewOfFile(mBuffer + mCapacity);
+#else
+    ::munmap(mBuffer, static_cast<size_t>(mCapacity) * 2);
+#endif
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+////////////////////////////////////////////////
+//   ޸𸮸  ּҿ     
+// [0, capacity) ڿ   [capacity, capacity * 2) ̾Ƿ
+//   ִ    ִ  ׻   ӵȴ (RingBuffer  ̽)
+// 뷮  (Linux : , Windows : Ҵ  64KB) 2 ŵ øȴ
+////////////////////////////////////////////////
+class MirroredRingBuffer
+{
+public:
+    enum { DEFAULT_SIZE = 4096 * 2 };
+
+    MirroredRingBuffer() : MirroredRingBuffer(DEFAULT_SIZE) {}
+    MirroredRingBuffer(int bufferSize);
+    ~MirroredRingBuffer();
+
+    MirroredRingBuffer(const MirroredRingBuffer& other) = delete;
+    MirroredRingBuffer& operator=(const MirroredRingBuffer& other) = delete;
+
+    inline void  ClearBuffer(void) { mFront = mRear = 0; }
+
+    inline int   GetCapacity(void) const { return static_cast<int>(mCapacity); }
+    inline int   GetUseSize(void) const { return static_cast<int>(mRear - mFront); }
+    inline int   GetFreeSize(void) const { return static_cast<int>(mCapacity - (mRear - mFront)); }
+    inline char* GetFrontBufferPtr(void) const { return mBuffer + (mFront & mMask); }
+    inline char* GetRearBufferPtr(void) const { return mBuffer + (mRear & mMask); }
+
+    //  ͷ ܺο ѹ濡   ִ  (׻   ü)
+    inline int GetDirectEnqueueSize(void) const { return GetFreeSize(); }
+
+    //  ͷ ܺο ѹ濡   ִ  (׻   ü)
+    inline int GetDirectDequeueSize(void) const { return GetUseSize(); }
+
+    inline bool Enqueue(const char* data, int dataSize)
+    {
+        if (GetFreeSize() < dataSize)
+        {
+            return false;
+        }
+
+        memcpy(GetRearBufferPtr(), data, dataSize);
+        mRear += dataSize;
+
+        return true;
+    }
+
+    inline bool Dequeue(char* data, int dataSize)
+    {
+        if (false == Peek(data, dataSize))
+        {
+            return false;
+        }
+
+        mFront += dataSize;
+
+        return true;
+    }
+
+    inline bool Peek(char* data, int dataSize) const
+    {
+        if (GetUseSize() < dataSize)
+        {
+            return false;
+        }
+
+        memcpy(data, GetFrontBufferPtr(), dataSize);
+
+        return true;
+    }
+
+    // Front  ̵(), ̵  θ ȯ
+    inline bool MoveFront(int size)
+    {
+        if (GetUseSize() < size)
+        {
+            return false;
+        }
+
+        mFront += size;
+
+        return true;
+    }
+
+    // Rear  ̵(ǹ  ), ̵  θ ȯ
+    inline bool MoveRear(int size)
+    {
+        if (GetFreeSize() < size)
+        {
+            return false;
+        }
+
+        mRear += size;
+
+        return true;
+    }
+
+private:
+    char*       mBuffer;        //   ּ (mCapacity * 2 ŭ  )
+    uint32_t    mCapacity;
+    uint32_t    mMask;
+
+    //   ϴ ġ -  ġ mMask Ѵ (÷ο Ǿ ̴ )
+    uint32_t    mFront = 0;
+    uint32_t    mRear = 0;
+};
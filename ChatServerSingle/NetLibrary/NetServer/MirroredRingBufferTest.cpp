@@ -0,0 +1,182 @@
+////////////////////////////////////////////////
+// MirroredRingBuffer Ȯ -  (뷮) Ѿ /бⰡ   ̾ 
+// Ʈ  ʴ ܵ  ,  Ȯ ִٸ 1 ȯѴ
+// Linux : g++ -std=c++17 -O2 -I../.. MirroredRingBufferTest.cpp MirroredRingBuffer.cpp ../Logger/Logger.cpp ../CrashDump/CrashDump.cpp ../Platform/LinuxCompat.cpp -o MirroredRingBufferTest -lpthread
+////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cwchar>
+#include <vector>
+
+#include "MirroredRingBuffer.h"
+
+static int g_failCount = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { wprintf(L"FAIL %hs:%d %hs\n", __FILE__, __LINE__, #Condition); g_failCount++; } } while (0)
+
+// ġ ٸ  - ߳  ٷ 巯
+static char patternByte(const uint32_t position)
+{
+    return static_cast<char>((position * 131u + 7u) ^ (position >> 8));
+}
+
+static void fillPattern(char* buffer, const int size, const uint32_t startPosition)
+{
+    for (int i = 0; i < size; ++i)
+    {
+        buffer[i] = patternByte(startPosition + static_cast<uint32_t>(i));
+    }
+}
+
+static bool matchPattern(const char* buffer, const int size, const uint32_t startPosition)
+{
+    for (int i = 0; i < size; ++i)
+    {
+        if (buffer[i] != patternByte(startPosition + static_cast<uint32_t>(i)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Enqueue/Peek/Dequeue 踦 Ѵ  memcpy   óϴ
+static void testEnqueueAcrossBoundary(void)
+{
+    MirroredRingBuffer ringBuffer;
+    const int capacity = ringBuffer.GetCapacity();
+
+    CHECK((capacity & (capacity - 1)) == 0);
+    CHECK(capacity >= MirroredRingBuffer::DEFAULT_SIZE);
+
+    //  100Ʈ ձ ġ Ű д
+    std::vector<char> buffer(capacity);
+    CHECK(ringBuffer.MoveRear(capacity - 100));
+    CHECK(ringBuffer.MoveFront(capacity - 100));
+    CHECK(ringBuffer.GetUseSize() == 0);
+    CHECK(ringBuffer.GetDirectEnqueueSize() == capacity);
+
+    fillPattern(buffer.data(), 300, 0);
+    CHECK(ringBuffer.Enqueue(buffer.data(), 300));
+    CHECK(ringBuffer.GetDirectDequeueSize() == 300);
+
+    // 踦  200Ʈ  ʿ  Ѵ
+    CHECK(matchPattern(ringBuffer.GetFrontBufferPtr(), 300, 0));
+    CHECK(matchPattern(ringBuffer.GetFrontBufferPtr() - (capacity - 100), 200, 100));
+
+    std::vector<char> readBuffer(300);
+    CHECK(ringBuffer.Peek(readBuffer.data(), 300));
+    CHECK(matchPattern(readBuffer.data(), 300, 0));
+
+    CHECK(ringBuffer.Dequeue(readBuffer.data(), 150));
+    CHECK(matchPattern(readBuffer.data(), 150, 0));
+
+    // Front 踦 Ѿ -  ġ  ƿ´
+    CHECK(ringBuffer.Dequeue(readBuffer.data(), 150));
+    CHECK(matchPattern(readBuffer.data(), 150, 150));
+    CHECK(ringBuffer.GetUseSize() == 0);
+    CHECK(ringBuffer.GetFrontBufferPtr() == ringBuffer.GetRearBufferPtr());
+}
+
+// recvó Rear ͷ   ü ٷ  MoveRear() ϴ 
+static void testDirectWriteAcrossBoundary(void)
+{
+    MirroredRingBuffer ringBuffer;
+    const int capacity = ringBuffer.GetCapacity();
+
+    CHECK(ringBuffer.MoveRear(capacity / 2 + 17));
+    CHECK(ringBuffer.MoveFront(capacity / 2 + 17));
+
+    //   ׻   - 뷮 ü     ִ
+    const int directSize = ringBuffer.GetDirectEnqueueSize();
+    CHECK(directSize == capacity);
+
+    fillPattern(ringBuffer.GetRearBufferPtr(), directSize, 1000);
+    CHECK(ringBuffer.MoveRear(directSize));
+    CHECK(ringBuffer.GetFreeSize() == 0);
+    CHECK(ringBuffer.GetDirectEnqueueSize() == 0);
+    CHECK(false == ringBuffer.MoveRear(1));
+
+    char oneByte = 0;
+    CHECK(false == ringBuffer.Enqueue(&oneByte, 1));
+
+    //   ¿   ִ   
+    CHECK(ringBuffer.GetDirectDequeueSize() == capacity);
+    CHECK(matchPattern(ringBuffer.GetFrontBufferPtr(), capacity, 1000));
+
+    //  ڿ  Ʈ  ( °  )  ޸𸮴
+    const int tailSize = capacity - (capacity / 2 + 17);
+    const char* mappingStart = ringBuffer.GetFrontBufferPtr() - (capacity / 2 + 17);
+    CHECK(matchPattern(mappingStart, capacity / 2 + 17, 1000 + static_cast<uint32_t>(tailSize)));
+
+    std::vector<char> readBuffer(capacity);
+    CHECK(false == ringBuffer.Peek(readBuffer.data(), capacity + 1));
+    CHECK(ringBuffer.Dequeue(readBuffer.data(), capacity));
+    CHECK(matchPattern(readBuffer.data(), capacity, 1000));
+    CHECK(ringBuffer.GetUseSize() == 0);
+}
+
+// ũⰡ  /б⸦   ݺϸ鼭  
+static void testManyLaps(void)
+{
+    MirroredRingBuffer ringBuffer;
+    const int capacity = ringBuffer.GetCapacity();
+
+    std::vector<char> buffer(capacity);
+    uint32_t writePosition = 0;
+    uint32_t readPosition = 0;
+    uint32_t randomState = 0x1234'5678;
+
+    auto nextRandom = [&randomState](const int range)
+        {
+            randomState ^= randomState << 13;
+            randomState ^= randomState >> 17;
+            randomState ^= randomState << 5;
+            return static_cast<int>(randomState % static_cast<uint32_t>(range)) + 1;
+        };
+
+    for (int round = 0; round < 200'000; ++round)
+    {
+        int writeSize = nextRandom(capacity / 3);
+        if (writeSize > ringBuffer.GetFreeSize())
+        {
+            writeSize = ringBuffer.GetFreeSize();
+        }
+
+        fillPattern(buffer.data(), writeSize, writePosition);
+        CHECK(ringBuffer.Enqueue(buffer.data(), writeSize));
+        writePosition += static_cast<uint32_t>(writeSize);
+
+        int readSize = nextRandom(capacity / 3);
+        if (readSize > ringBuffer.GetUseSize())
+        {
+            readSize = ringBuffer.GetUseSize();
+        }
+
+        CHECK(ringBuffer.Dequeue(buffer.data(), readSize));
+
+        if (false == matchPattern(buffer.data(), readSize, readPosition))
+        {
+            CHECK(false);
+            return;
+        }
+
+        readPosition += static_cast<uint32_t>(readSize);
+        CHECK(ringBuffer.GetUseSize() == static_cast<int>(writePosition - readPosition));
+    }
+
+    // 뷮 õ 踦  - 踦  Ѿ
+    CHECK(writePosition > static_cast<uint32_t>(capacity) * 1000);
+}
+
+int main(void)
+{
+    testEnqueueAcrossBoundary();
+    testDirectWriteAcrossBoundary();
+    testManyLaps();
+
+    wprintf(L"MirroredRingBufferTest : %ls\n", g_failCount == 0 ? L"OK" : L"FAILED");
+    return g_failCount == 0 ? 0 : 1;
+}
@@ -1,4 +1,6 @@
+#ifdef _WIN32
 #include <process.h>
+#endif
 
 #include "NetClient.h"
 #include "NetUtils.h"
@@ -54,17 +56,18 @@ bool NetClient::SendPacket(Serializer* packet)
         return false;
     }
 
-    if (!packet->IsSendPrepared())
-    {
-        packet->prepareSend();
-    }
+    // NetClient ׻  (Chain)  (ŷ ۽   ȣ    ִ)
+    Serializer* sendPacket = packet->getSendPacket(ENetworkCipher::Chain);
 
-    int retSend = ::send(mSocket, packet->GetFullBufferPointer(), packet->GetFullSize(), 0);
+    // ׸Ʈ ̾ Ŷ   (ŷ ̹Ƿ   )
+    sendPacket->ForEachBuffer([this](char* buffer, const uint32_t length) {
+        int retSend = ::send(mSocket, buffer, length, 0);
 
-    if (retSend == SOCKET_ERROR)
-    {
-        mSendErrorCode = ::WSAGetLastError();
-    }
+        if (retSend == SOCKET_ERROR)
+        {
+            mSendErrorCode = ::WSAGetLastError();
+        }
+        });
 
     return true;
 }
@@ -102,7 +105,7 @@ unsigned int NetClient::recvThread(void* netClient)
             bool retPeek = client->mRecvBuffer.Peek((char*)&header, sizeof(header));
             ASSERT_LIVE(retPeek == true, L"Client RecvBuffer Peek() Error");
 
-#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
+#if NETWORK_HEADER_USE_TYPE != NETWORK_HEADER_TYPE_LAN
             // NetClient - code check
             ASSERT_LIVE(header.Code == NETWORK_HEADER_CODE, L"client invalid NETWORK_HEADER_CODE received");
 #endif
@@ -114,21 +117,39 @@ unsigned int NetClient::recvThread(void* netClient)
                 break;
             }
 
-            // 3. packet copy
-            Serializer* packet = Serializer::l_packetPool.Alloc();
-            packet->IncrementRefCount();
-            packet->Clear();
+            // 3. packet copy - ̷ε ̷ ũ  
+            Serializer* packet = Serializer::Alloc(header.Length);
 
-            bool retDequeue = client->mRecvBuffer.Dequeue(packet->GetFullBufferPointer(), header.Length + sizeof(NetworkHeader));
-            ASSERT_LIVE(retDequeue == true, L"client RecvBuffer Dequeue() Error");
-            packet->SetUseSize(header.Length);
+            if (header.Length <= packet->GetBufferSize())
+            {
+                bool retDequeue = client->mRecvBuffer.Dequeue(packet->GetFullBufferPointer(), header.Length + sizeof(NetworkHeader));
+                ASSERT_LIVE(retDequeue == true, L"client RecvBuffer Dequeue() Error");
+                packet->SetUseSize(header.Length);
+
+#if NETWORK_HEADER_USE_TYPE != NETWORK_HEADER_TYPE_LAN
+                // NetClient - decode packet
+                bool bIsValidPacket = packet->decode();
+                ASSERT_LIVE(bIsValidPacket, L"client received invalid packet (decode failed)");
+#endif
+            }
+            else
+            {
+                // ù ۸ Ѵ Ŷ - ̾ ä ڵ  ׸Ʈ  ´
+                char largePacket[RingBuffer::DEFAULT_SIZE];
 
-#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
-            // NetClient - decode packet
-            bool bIsValidPacket = packet->decode();
-            ASSERT_LIVE(bIsValidPacket, L"client received invalid packet (decode failed)");
+                bool retDequeue = client->mRecvBuffer.Dequeue(largePacket, header.Length + sizeof(NetworkHeader));
+                ASSERT_LIVE(retDequeue == true, L"client RecvBuffer Dequeue() Error");
+
+#if NETWORK_HEADER_USE_TYPE != NETWORK_HEADER_TYPE_LAN
+                // NetClient - decode packet
+                bool bIsValidPacket = Serializer::decode(largePacket);
+                ASSERT_LIVE(bIsValidPacket, L"client received invalid packet (decode failed)");
 #endif
 
+                bool retInsert = packet->InsertByte(largePacket + sizeof(NetworkHeader), header.Length);
+                ASSERT_LIVE(retInsert == true, L"client packet InsertByte() Error");
+            }
+
             // 5. OnReceive()
             client->OnReceive(packet);
         }
@@ -1,7 +1,10 @@
 #pragma comment(lib, "winmm")
 
+#include <algorithm>
 #include <iostream>
+#ifdef _WIN32
 #include <process.h>
+#endif
 
 #include "NetUtils.h"
 #include "NetServer.h"
@@ -9,6 +12,34 @@
 #include "Session.h"
 #include "../Tool/CpuUsageMonitor.h"
 
+//    ŸӾƿ -  θ Ȯϴ ֱ (Windows closesocket()  ⸦   )
+static constexpr int ACCEPT_WAIT_TIMEOUT_MS = 100;
+
+// Accept 尡     ޴ ִ  
+static constexpr uint32_t ACCEPT_BATCH_SIZE = 64;
+
+//  ̺  ϳ   (2 ŵ -  Ű  Ʈ  ε ȴ)
+static constexpr uint32_t SESSION_BLOCK_SHIFT = 8;
+static constexpr uint32_t SESSION_BLOCK_SIZE = 1 << SESSION_BLOCK_SHIFT;
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+// GQCSEx()    ִ Ϸ  
+static constexpr ULONG IOCP_DEQUEUE_BATCH_SIZE = 64;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+// mNotifyEvent epoll ̺Ʈ  ( IDδ    )
+static constexpr uint64_t NOTIFY_EVENT_KEY = UINT64_MAX;
+
+// epoll_wait()    ִ ̺Ʈ 
+static constexpr int EPOLL_MAX_EVENT_COUNT = 64;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+//  ϳ SQ ũ (CQ 4)
+static constexpr uint32_t URING_ENTRY_COUNT = 2048;
+
+//  ϳ provided buffer  ũ -  ʹ  ۿ  RecvBuffer ȴ
+static constexpr uint32_t URING_PROVIDED_BUFFER_COUNT = 4096;
+static constexpr uint32_t URING_PROVIDED_BUFFER_SIZE = 2048;
+#endif
+
 NetServer::~NetServer()
 {
 	if (mbIsRunning)
@@ -26,44 +57,125 @@ void NetServer::Start(const uint16_t port, const uint32_t maxSessionCount, const
 
 	mPort = port;
 	mMaxSessionCount = maxSessionCount;
-	mThreadCount = iocpWorkerThreadCount + 2;
+
+	if (mAcceptThreadCount == 0)
+	{
+		mAcceptThreadCount = 1;
+	}
+
+	mThreadCount = mAcceptThreadCount + 1 + iocpWorkerThreadCount;
 
 	if (mMaxPayloadLength == 0)
 	{
 		mMaxPayloadLength = UINT16_MAX;
 	}
 
+	if (mMaxSendBufferCount == 0 || mMaxSendBufferCount > Session::MAX_SEND_BUF_COUNT)
+	{
+		mMaxSendBufferCount = Session::MAX_SEND_BUF_COUNT;
+	}
+
+	if (mSendCoalescingSize > Session::SEND_SLAB_SIZE)
+	{
+		mSendCoalescingSize = Session::SEND_SLAB_SIZE;
+	}
+
+	// Ʈ ѵ ִ Ŷ ϳ  ū Ŷ    
+	if (mMaxRecvBytesPerSecond > 0 && mMaxRecvBytesPerSecond < sizeof(NetworkHeader) + mMaxPayloadLength)
+	{
+		mMaxRecvBytesPerSecond = sizeof(NetworkHeader) + mMaxPayloadLength;
+	}
+
+	// IP   ̺ -   ̻  ʵ ִ     
+	if (mMaxConnectionsPerIp > 0 || mMaxConnectsPerIpPerSecond > 0)
+	{
+		mIpConnectionTable.Init(mMaxSessionCount * 2);
+	}
+
 	::timeBeginPeriod(1);
 
 	NetUtils::WSAStartup();
 
-	mIOCP = NetUtils::CreateNewIOCP(iocpConcurrentThreadCount);
+	createListenSockets();
+
+	//   Ŀ 帶 IOCP/epoll ϳ ΰ,  Accept  SessionListKey ȴ
+	mIoShardCount = mbIsIoSharded ? iocpWorkerThreadCount : 1;
+	mBoundIoShardCount = 0;
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+	mIOCPs = new HANDLE[mIoShardCount];
+
+	for (uint32_t i = 0; i < mIoShardCount; ++i)
+	{
+		mIOCPs[i] = NetUtils::CreateNewIOCP(mbIsIoSharded ? 1 : iocpConcurrentThreadCount);
+	}
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	// epoll       - iocpWorkerThreadCount 
+	mEpolls = new int[mIoShardCount];
+	mNotifyEvent = NetUtils::CreateNotifyEvent();
+
+	for (uint32_t i = 0; i < mIoShardCount; ++i)
+	{
+		mEpolls[i] = NetUtils::CreateNewEpoll();
+		NetUtils::RegisterNotifyEvent(mNotifyEvent, mEpolls[i], NOTIFY_EVENT_KEY);
+	}
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	//  CQ  尡 Բ ٸ   - ׻ Ŀ 帶  ϳ 
+	mIoShardCount = iocpWorkerThreadCount;
+	mRings = new IoUring[mIoShardCount];
 
-	// Create Sessions
-	mSessionList = new Session[mMaxSessionCount];
+	for (uint32_t i = 0; i < mIoShardCount; ++i)
+	{
+		mRings[i].Init(URING_ENTRY_COUNT, URING_PROVIDED_BUFFER_COUNT, URING_PROVIDED_BUFFER_SIZE);
+	}
+#endif
 
-	for (uint32_t i = 0; i < mMaxSessionCount; ++i)
+	// Create Sessions -   迭 ,   ù ϸ   Ű ڶ  ϳ ߰Ѵ
+	mMaxSessionBlockCount = (mMaxSessionCount + SESSION_BLOCK_SIZE - 1) / SESSION_BLOCK_SIZE;
+	mSessionBlocks = new Session*[mMaxSessionBlockCount]{};
+	mSendSlabBlocks = new char*[mMaxSessionBlockCount]{};
+	mSessionBlockCount = 0;
+	::InitializeSRWLock(&mSessionTableLock);
+	::InitializeSRWLock(&mRetiredSessionKeyLock);
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	// SendSlab   ϸ Ƿ   ŭ    ĭ д
+	if (mSendCoalescingSize > 0)
 	{
-		mSessionList[i].bDisconnected = true;
-		mUnusedSessionKeys.Push(i);
+		for (uint32_t i = 0; i < mIoShardCount; ++i)
+		{
+			mRings[i].InitFixedBuffers(mMaxSessionBlockCount);
+		}
 	}
+#endif
+
+	growSessionTable();
 
 	// Create threads
 	mThreads = new HANDLE[mThreadCount];
 
-	// AcceptThread
-	mThreads[0] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, acceptThread, this, 0, nullptr));
+	// AcceptThreads
+	for (uint32_t i = 0; i < mAcceptThreadCount; ++i)
+	{
+		mThreads[i] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, acceptThread, this, 0, nullptr));
+	}
 
 	// MonitorThread
-	mThreads[1] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, monitorThread, this, 0, nullptr));
+	mThreads[mAcceptThreadCount] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, monitorThread, this, 0, nullptr));
 
 	// IOCP WorkerThreads
-	for (uint32_t i = 2; i < mThreadCount; ++i)
+	for (uint32_t i = mAcceptThreadCount + 1; i < mThreadCount; ++i)
 	{
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
 		mThreads[i] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, iocpWorkerThread, this, 0, nullptr));
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+		mThreads[i] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, epollWorkerThread, this, 0, nullptr));
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+		mThreads[i] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, uringWorkerThread, this, 0, nullptr));
+#endif
 	}
 
-	LOGF(ELogLevel::System, L"NetServer Running (version %s)", GetServerVersion().c_str());
+	LOGF(ELogLevel::System, L"NetServer Running (version %ls)", GetServerVersion().c_str());
 }
 
 void NetServer::Shutdown(void)
@@ -72,14 +184,27 @@ void NetServer::Shutdown(void)
 
 	mbIsRunning = false;
 
-	// accept thread
-	::closesocket(mListenSocket);
+	// accept threads (Windows  ŸӾƿ Ŀ Ḧ ȮѴ)
+	for (uint32_t i = 0; i < mListenSocketCount; ++i)
+	{
+		NetUtils::WakeUpAccept(mListenSockets[i]);
+	}
 
 	// IOCP worker threads
-	for (uint32_t i = 0; i < mThreadCount - 2; ++i)
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+	for (uint32_t i = 0; i < mThreadCount - mAcceptThreadCount - 1; ++i)
 	{
-		::PostQueuedCompletionStatus(mIOCP, 0, 0, 0);
+		::PostQueuedCompletionStatus(mIOCPs[i % mIoShardCount], 0, 0, 0);
 	}
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	// level-triggered̹Ƿ   ȣ  Ŀ 
+	NetUtils::SignalNotifyEvent(mNotifyEvent);
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	for (uint32_t i = 0; i < mIoShardCount; ++i)
+	{
+		mRings[i].PrepareNotify();
+	}
+#endif
 
 	for (uint32_t i = 0; i < mThreadCount; ++i)
 	{
@@ -91,16 +216,101 @@ void NetServer::Shutdown(void)
 		::CloseHandle(mThreads[i]);
 	}
 
-	::CloseHandle(mIOCP);
+	for (uint32_t i = 0; i < mListenSocketCount; ++i)
+	{
+		::closesocket(mListenSockets[i]);
+	}
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+	for (uint32_t i = 0; i < mIoShardCount; ++i)
+	{
+		::CloseHandle(mIOCPs[i]);
+	}
+
+	delete[] mIOCPs;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	::close(mNotifyEvent);
+
+	for (uint32_t i = 0; i < mIoShardCount; ++i)
+	{
+		::close(mEpolls[i]);
+	}
+
+	delete[] mEpolls;
+
+	uint64_t releasedSessionID;
+	while (mReleaseQueue.TryDequeue(releasedSessionID))
+	{
+	}
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	delete[] mRings;
+
+	uint64_t releasedSessionID;
+	while (mReleaseQueue.TryDequeue(releasedSessionID))
+	{
+	}
+#endif
 
 	delete[] mThreads;
 	mThreads = nullptr;
 
-	delete[] mSessionList;
-	mSessionList = nullptr;
+	delete[] mListenSockets;
+	mListenSockets = nullptr;
+
+	// ִ ǵ RecvBuffer ް Ǯ 
+	for (uint32_t blockIndex = 0; blockIndex < mSessionBlockCount; ++blockIndex)
+	{
+		for (uint32_t i = 0; i < SESSION_BLOCK_SIZE; ++i)
+		{
+			Session& session = mSessionBlocks[blockIndex][i];
+
+			if (session.RecvBuffer != nullptr)
+			{
+				mRecvBufferPool.Free(session.RecvBuffer);
+			}
+		}
+	}
+
+	mRecvBufferPool.Clear();
+
+	for (uint32_t blockIndex = 0; blockIndex < mSessionBlockCount; ++blockIndex)
+	{
+		delete[] mSessionBlocks[blockIndex];
+	}
+
+	delete[] mSessionBlocks;
+	mSessionBlocks = nullptr;
+
+	for (uint32_t blockIndex = 0; blockIndex < mSessionBlockCount; ++blockIndex)
+	{
+		delete[] mSendSlabBlocks[blockIndex];
+	}
+
+	delete[] mSendSlabBlocks;
+	mSendSlabBlocks = nullptr;
+	mSessionBlockCount = 0;
+	mMaxSessionBlockCount = 0;
+	mUnusedSessionKeys.Clear();
+
+	RetiredSessionKey retiredSessionKey;
+	while (mRetiredSessionKeys.TryDequeue(retiredSessionKey))
+	{
+	}
+
+	mGraceSessionKeys.clear();
+
+	mIpConnectionTable.Release();
+
+	uint64_t dirtySessionID;
+	while (mSendDirtySessionIDs.TryDequeue(dirtySessionID))
+	{
+	}
 
 	mbIsTcpNodelay = false;
 	mbIsSendBufferSizeZero = false;
+	mbIsIoSharded = false;
+	mbIsSendDeferred = false;
+	mbIsAcceptPaused = false;
 	mSessionAcceptedCount = 0;
 	mSessionDisconnectedCount = 0;
 	mPort = 0;
@@ -108,8 +318,29 @@ void NetServer::Shutdown(void)
 	mSessionCount = 0;
 	mMaxSessionCount = 0;
 	mThreadCount = 0;
-	mIOCP = 0;
-	mListenSocket = INVALID_SOCKET;
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+	mIOCPs = nullptr;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	mEpolls = nullptr;
+	mNotifyEvent = -1;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	mRings = nullptr;
+#endif
+	mIoShardCount = 0;
+	mBoundIoShardCount = 0;
+	mListenSocketCount = 0;
+	mAcceptThreadCount = 0;
+	mBoundListenSocketCount = 0;
+	mMaxSendBufferCount = 0;
+	mSendCoalescingSize = 0;
+	mMaxSendQueueCount = 0;
+	mMaxSendQueueBytes = 0;
+	mSendOverflowPolicy = ESendOverflowPolicy::DropNewest;
+	mMaxConnectionsPerIp = 0;
+	mMaxConnectsPerIpPerSecond = 0;
+	mMaxRecvPacketsPerSecond = 0;
+	mMaxRecvBytesPerSecond = 0;
+	mSocketTuningProfile = {};
 	::ZeroMemory(&mMonitoringVariables, sizeof(MonitoringVariables));
 	::ZeroMemory(&mMonitorResult, sizeof(MonitoringVariables));
 
@@ -129,26 +360,123 @@ void NetServer::SendPacket(const uint64_t sessionID, Serializer* packet)
 		return;
 	}
 
-	int32_t retIoCount = static_cast<int32_t>(session->IncrementIoCount());
+	// IoCount  б   ´ -  ȿ Ǵ  Ű  ʴ´
+	mSessionEpoch.Enter();
 
-	if (retIoCount < 0 || session->bDisconnected || session->bDisconnectRegistered || session->ID != sessionID)
+	if (false == session->IsAliveWithoutPin(sessionID))
 	{
-		session->DecrementIoCount();
+		mSessionEpoch.Leave();
 		return;
 	}
 
-	if (!packet->IsSendPrepared())
+	//  ȣȭ  ڵ Ŷ (ٸ  ̹ ڵǾٸ ȯ 纻)
+	Serializer* sendPacket = packet->getSendPacket(session->getCipher());
+
+	if (false == reserveSendQueue(session, sendPacket))
 	{
-		packet->prepareSend();
+		mSessionEpoch.Leave();
+		return;
 	}
 
-	packet->IncrementRefCount();
+	sendPacket->IncrementRefCount();
 
-	session->SendQueue.Enqueue(packet);
+	enqueueSendPacket(session, sessionID, sendPacket);
 
-	session->PostSend();
+	mSessionEpoch.Leave();
+}
 
-	session->DecrementIoCount();
+void NetServer::SendPacketToMany(const uint64_t* sessionIDs, const uint32_t sessionCount, Serializer* packet)
+{
+	if (packet == nullptr || sessionCount == 0)
+	{
+		return;
+	}
+
+	//   ŭ  ̸ ´ (ȣ    Ƿ ߿  ʴ´)
+	// ȣȭ  Ǹ ٸ  Ƿ ڵ   Ѵ
+	packet->AddRefCount(sessionCount);
+
+	uint32_t unusedRefCount = 0;
+
+	//   ϳ б  ȮѴ
+	mSessionEpoch.Enter();
+
+	for (uint32_t i = 0; i < sessionCount; ++i)
+	{
+		const uint64_t sessionID = sessionIDs[i];
+
+		Session* session = findSessionOrNull(sessionID);
+
+		if (session == nullptr || false == session->IsAliveWithoutPin(sessionID) || false == reserveSendQueue(session, packet))
+		{
+			unusedRefCount++;
+			continue;
+		}
+
+		//  ٸ  ȯ 纻  - ̸    纻  ´
+		Serializer* sendPacket = packet->getSendPacket(session->getCipher());
+
+		if (sendPacket != packet)
+		{
+			sendPacket->IncrementRefCount();
+			unusedRefCount++;
+		}
+
+		enqueueSendPacket(session, sessionID, sendPacket);
+	}
+
+	mSessionEpoch.Leave();
+
+	packet->SubtractRefCount(unusedRefCount);
+}
+
+void NetServer::enqueueSendPacket(Session* session, const uint64_t sessionID, Serializer* packet)
+{
+	session->pushSendPacket(packet);
+
+	if (mbIsSendDeferred)
+	{
+		// ̹ Ͽ ִٸ ٽ  ʴ´
+		if (InterlockedExchange(&session->bSendDirty, 1) == 0)
+		{
+			mSendDirtySessionIDs.Enqueue(sessionID);
+		}
+	}
+	else
+	{
+		// ۽ ɰ ȴٸ PostSend() ۽  鼭  θ ٽ ȮѴ
+		//  ̿ Ǿ SendQueue  Ŷ  Ű   Init() ȴ (   ڿ  Ŷ)
+		session->PostSend();
+	}
+}
+
+void NetServer::FlushSends(void)
+{
+	uint64_t sessionID;
+
+	//  ü ϳ б  óѴ
+	mSessionEpoch.Enter();
+
+	while (mSendDirtySessionIDs.TryDequeue(sessionID))
+	{
+		Session* session = findSessionOrNull(sessionID);
+		if (session == nullptr)
+		{
+			continue;
+		}
+
+		if (false == session->IsAliveWithoutPin(sessionID))
+		{
+			continue;
+		}
+
+		// ۽ ɱ    ̿  Ŷ  ٽ Ͽ 
+		InterlockedExchange(&session->bSendDirty, 0);
+
+		session->PostSend();
+	}
+
+	mSessionEpoch.Leave();
 }
 
 void NetServer::Disconnect(const uint64_t sessionID)
@@ -167,11 +495,12 @@ void NetServer::Disconnect(const uint64_t sessionID)
 		return;
 	}
 
+	//  ǵ帮Ƿ б  ƴ IoCount ´ (    ڵ ٸ ῡ   )
 	LOGF(ELogLevel::Debug, L"NetServer::Disconnect(%llu)", session->ID);
 
 	InterlockedExchange8(reinterpret_cast<CHAR*>(&session->bDisconnectRegistered), true);
 	
-	::CancelIoEx(reinterpret_cast<HANDLE>(session->Socket), NULL); // ̹ ɷִ IO 
+	session->CancelIo(); // ̹ ɷִ IO 
 
 	session->DecrementIoCount();
 }
@@ -189,29 +518,101 @@ void NetServer::SendAndDisconnect(const uint64_t sessionID, Serializer* packet)
 		return;
 	}
 
-	int32_t retIoCount = static_cast<int32_t>(session->IncrementIoCount());
+	mSessionEpoch.Enter();
 
-	if (retIoCount < 0 || session->bDisconnected || session->bDisconnectRegistered || session->ID != sessionID)
+	if (false == session->IsAliveWithoutPin(sessionID))
 	{
-		session->DecrementIoCount();
+		mSessionEpoch.Leave();
 		return;
 	}
 
-	// Disconnect register - SendPacket  κи ̰ 
-	session->bDisconnectRegistered = true;
+	// SendPacket  κи ̰  - SendQueue   ۽ Ϸ   Ḧ Ѵ
+	// (⼭ bDisconnectRegistered  PostSend() ۽  ʴ´)
+	session->bDisconnectAfterSend = true;
+
+	Serializer* sendPacket = packet->getSendPacket(session->getCipher());
+
+	sendPacket->IncrementRefCount();
+
+	session->pushSendPacket(sendPacket);
+
+	session->PostSend();
+
+	mSessionEpoch.Leave();
+}
+
+bool NetServer::reserveSendQueue(Session* session, const Serializer* packet)
+{
+	const uint32_t packetSize = packet->GetFullSize();
+
+	auto isOverflowed = [this, session, packetSize]()
+		{
+			return (mMaxSendQueueCount > 0 && session->SendQueue.GetCount() >= mMaxSendQueueCount)
+				|| (mMaxSendQueueBytes > 0 && session->SendQueueBytes + packetSize > mMaxSendQueueBytes);
+		};
+
+	auto disconnectOverflowed = [this, session]()
+		{
+			LOGF(ELogLevel::Debug, L"NetServer SendQueue overflow - Disconnect(%llu)", session->ID);
+
+			if (false == InterlockedExchange8(reinterpret_cast<CHAR*>(&session->bDisconnectRegistered), true))
+			{
+				addMonitoringCount(EMonitoringCounter::SendOverflowDisconnect);
+			}
+
+			// SendPacket() IoCount  ʰ Ƿ,  ǵ帮     ȮѴ
+			if (static_cast<int32_t>(session->IncrementIoCount()) >= 0)
+			{
+				session->CancelIo();
+			}
+
+			session->DecrementIoCount();
+			return false;
+		};
 
-	if (!packet->IsSendPrepared())
+	if (false == isOverflowed())
 	{
-		packet->prepareSend();
+		return true;
 	}
 
-	packet->IncrementRefCount();
+	switch (mSendOverflowPolicy)
+	{
+	case ESendOverflowPolicy::DropOldest:
+	{
+		// ۽  ̰  Ǵ Ŷ(SetDroppable) տ  - α,  ̵   Ŷ 
+		uint32_t droppedCount = 0;
+		Serializer* oldPacket;
 
-	session->SendQueue.Enqueue(packet);
+		while (isOverflowed() && session->popDroppableSendPacket(oldPacket))
+		{
+			oldPacket->DecrementRefCount();
+			droppedCount++;
+		}
 
-	session->PostSend();
+		addMonitoringCount(EMonitoringCounter::SendDropOldest, droppedCount);
 
-	session->DecrementIoCount();
+		//  µ ڶ (Ŷ ϳ Ʈ ѵ ũٸ) ׳ ִ´
+		if (false == isOverflowed() || session->SendQueue.IsEmpty())
+		{
+			return true;
+		}
+
+		// տ    Ŷ ִ -  Ŷ  ȴٸ  Ŷ , ƴ϶  ϴ Ŭ̾Ʈ  ´
+		if (packet->IsDroppable())
+		{
+			addMonitoringCount(EMonitoringCounter::SendDropNewest);
+			return false;
+		}
+
+		return disconnectOverflowed();
+	}
+	case ESendOverflowPolicy::Disconnect:
+		return disconnectOverflowed();
+	case ESendOverflowPolicy::DropNewest:
+	default:
+		addMonitoringCount(EMonitoringCounter::SendDropNewest);
+		return false;
+	}
 }
 
 bool NetServer::GetSessionAddress(const uint64_t sessionID, SOCKADDR_IN* outAddress) const
@@ -224,17 +625,17 @@ bool NetServer::GetSessionAddress(const uint64_t sessionID, SOCKADDR_IN* outAddr
 		return false;
 	}
 
-	int32_t retIoCount = static_cast<int32_t>(session->IncrementIoCount());
+	mSessionEpoch.Enter();
 
-	if (retIoCount < 0 || session->bDisconnected || session->bDisconnectRegistered || session->ID != sessionID)
+	if (false == session->IsAliveWithoutPin(sessionID))
 	{
-		session->DecrementIoCount();
+		mSessionEpoch.Leave();
 		return false;
 	}
 
 	*outAddress = session->Address;
 
-	session->DecrementIoCount();
+	mSessionEpoch.Leave();
 
 	return true;
 }
@@ -245,94 +646,76 @@ unsigned int NetServer::acceptThread(void* netServerParam)
 
 	NetServer* netServer = reinterpret_cast<NetServer*>(netServerParam);
 
-	// create socket
-	netServer->mListenSocket = NetUtils::CreateSocket();
-
-	// bind
-	NetUtils::BindSocket(netServer->mListenSocket, netServer->mPort);
-
-	// listen
-	NetUtils::SetSocketListen(netServer->mListenSocket);
+	// Accept 帶   ϳ  (  ϳ   )
+	uint32_t listenSocketIndex = (InterlockedIncrement(&netServer->mBoundListenSocketCount) - 1) % netServer->mListenSocketCount;
+	SOCKET listenSocket = netServer->mListenSockets[listenSocketIndex];
 
 	/************************* Server Listening Start *************************/
 
 	LOGF(ELogLevel::System, L"Accept Start (Port = %d)", netServer->mPort);
 
 	SOCKADDR_IN clientAddress{};	// Ŭ̾Ʈ ּ
-	uint32_t newSessionKey;			// ο  Key (  ü )
-	uint64_t newSessionID;			// ο  ID
-	Session* newSession;			// ο  ü
 
 	while (netServer->mbIsRunning)
 	{
-		// accept()
-		SOCKET clientSocket = NetUtils::GetAcceptedSocketOrInvalid(netServer->mListenSocket, &clientAddress);
-
-		// error handling
-		if (clientSocket == INVALID_SOCKET)
-		{
-			int errorCode = ::WSAGetLastError();
-
-			bool bThreadExit = errorCode == WSAEINTR && netServer->mbIsRunning == false;
-			if (bThreadExit)
-			{
-				break;
-			}
-
-			LOGF(ELogLevel::Error, L"AcceptThread accept() failed (errorCode = %d)", errorCode);
-			CrashDump::Crash();
-		}
-
-		// socket option
-		NetUtils::SetLinger(clientSocket, 1, 0);
-
-		if (netServer->mbIsSendBufferSizeZero)
-		{
-			NetUtils::SetSendBufferSize(clientSocket, 0);
-		}
-
-		if (netServer->mbIsTcpNodelay)
+		//    α׿ ܵΰ 簳 θ ȮѴ
+		if (netServer->mbIsAcceptPaused)
 		{
-			NetUtils::SetTcpNodelay(clientSocket);
+			::Sleep(ACCEPT_WAIT_TIMEOUT_MS);
+			continue;
 		}
 
-		// ǸƮκ  ´
-		bool bPopSuccess = netServer->mUnusedSessionKeys.TryPop(newSessionKey);
-
-		if (false == bPopSuccess)
+		//     
+		if (false == NetUtils::WaitForAcceptable(listenSocket, ACCEPT_WAIT_TIMEOUT_MS))
 		{
-			NetUtils::CloseSocket(clientSocket);
-			LOGF(ELogLevel::System, L"Max Session Count - Session Disconnected");
-
 			continue;
 		}
 
-		// ο  ID 
-		newSessionID = (++(netServer->mSessionAcceptedCount) & (0x0000'0000'FFFF'FFFFULL)) | (static_cast<uint64_t>(newSessionKey) << 32);
+		//     ׿ִ  Ƽ ޴´
+		uint32_t acceptedCount = 0;
 
-		//  
-		newSession = &netServer->mSessionList[newSessionKey];
-		
+		for (uint32_t i = 0; i < ACCEPT_BATCH_SIZE; ++i)
 		{
-			newSession->IncrementIoCount();
-
-			newSession->Init(clientSocket, clientAddress, netServer, newSessionID, newSessionKey);
+			// accept()
+			SOCKET clientSocket = NetUtils::GetAcceptedSocketOrInvalid(listenSocket, &clientAddress);
 
-			NetUtils::RegisterIOCP(clientSocket, netServer->mIOCP, reinterpret_cast<ULONG_PTR>(newSession));
+			// error handling
+			if (clientSocket == INVALID_SOCKET)
+			{
+				int errorCode = ::WSAGetLastError();
 
-			// accept log
-			//LOGF(ELogLevel::Debug, L"Accept - %s:%d", NetUtils::GetIpAddress(newSession->Address).c_str(), NetUtils::GetPortNumber(newSession->Address));
+				//    ޾Ұų ٸ Accept 尡  
+				if (errorCode == WSAEWOULDBLOCK)
+				{
+					break;
+				}
 
-			// monitoring
-			InterlockedIncrement(&netServer->mSessionCount);
+				// accept  Ŭ̾Ʈ  
+				if (errorCode == WSAECONNRESET || errorCode == WSAECONNABORTED)
+				{
+					continue;
+				}
 
-			netServer->OnAccept(newSession->ID);
+				//   (Linux shutdown() EINVAL ޴´)
+				if (false == netServer->mbIsRunning)
+				{
+					break;
+				}
 
-			netServer->mMonitoringVariables.AcceptTPS++;
+				LOGF(ELogLevel::Error, L"AcceptThread accept() failed (errorCode = %d)", errorCode);
+				CrashDump::Crash();
+			}
 
-			newSession->PostRecv();
+			if (netServer->acceptSession(clientSocket, clientAddress))
+			{
+				acceptedCount++;
+			}
+		}
 
-			newSession->DecrementIoCount();
+		// monitoring ( Accept 尡 ϹǷ ġ  )
+		if (acceptedCount > 0)
+		{
+			InterlockedAdd(reinterpret_cast<LONG*>(&netServer->mMonitoringVariables.AcceptTPS), acceptedCount);
 		}
 	}
 
@@ -341,185 +724,385 @@ unsigned int NetServer::acceptThread(void* netServerParam)
 	return 0;
 }
 
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+
 unsigned int NetServer::iocpWorkerThread(void* netServerParam)
 {
 	LOGF(ELogLevel::System, L"IOCP Worker Thread Start (ID : %d)", ::GetCurrentThreadId());
 
 	NetServer* netServer = reinterpret_cast<NetServer*>(netServerParam);
 
-	bool retGQCS;
-	NetworkHeader header{};
+	//    Ŀ  IOCP 
+	uint32_t shardIndex = (InterlockedIncrement(&netServer->mBoundIoShardCount) - 1) % netServer->mIoShardCount;
+	HANDLE iocp = netServer->mIOCPs[shardIndex];
 
-	while (netServer->mbIsRunning)
+	beginMonitoringBatch();
+
+	OVERLAPPED_ENTRY entries[IOCP_DEQUEUE_BATCH_SIZE];
+	bool bThreadExit = false;
+
+	while (false == bThreadExit)
 	{
-		DWORD transferredBytes = 0;
-		Session* session = 0;
-		OVERLAPPED* overlapped = 0;
+		ULONG removedCount = 0;
 
-		retGQCS = ::GetQueuedCompletionStatus(netServer->mIOCP, &transferredBytes, reinterpret_cast<ULONG_PTR*>(&session), &overlapped, INFINITE);
+		//   ý ݷ Ϸ     -  I/O TRUE ϵǸ    ȮѴ
+		if (FALSE == ::GetQueuedCompletionStatusEx(iocp, entries, IOCP_DEQUEUE_BATCH_SIZE, &removedCount, INFINITE, FALSE))
+		{
+			LOGF(ELogLevel::Error, L"GQCSEx FALSE, GetLastError() = %d", ::GetLastError());
+			CrashDump::Crash();
+		}
 
-		if (retGQCS) // GQCS return TRUE
+		for (ULONG i = 0; i < removedCount; ++i)
 		{
-			if (transferredBytes == 0 && overlapped == 0)
+			Session* session = reinterpret_cast<Session*>(entries[i].lpCompletionKey);
+			OVERLAPPED* overlapped = entries[i].lpOverlapped;
+
+			if (overlapped == nullptr)
 			{
-				if (session == 0)
-				{
-					//   -  Ż
-					break;
-				}
-				else
+				if (session != nullptr)
 				{
 					// OnRelease û PQCS ó
 					netServer->OnRelease(reinterpret_cast<const uint64_t>(session));
 					continue;
 				}
-			}
-		}
-		else// GQCS return FALSE
-		{
-			int errorCode = ::GetLastError();
 
-			switch (errorCode)
-			{
-			case ERROR_SEM_TIMEOUT:
-			{
-				LOGF(ELogLevel::Debug, L"GQCS FALSE, GetLastError() = %d (SEM_TIMEOUT) -> disconnect", errorCode, ::WSAGetLastError());
-			}
-			break;
-			case ERROR_NETNAME_DELETED:
-			case ERROR_CONNECTION_ABORTED:
-			case ERROR_OPERATION_ABORTED:
-			{
-				ASSERT_LIVE(session != nullptr, L"retGQCS FALSE, but Session is nullptr");
-			}
-			break;
-			default:
-			{
-				LOGF(ELogLevel::Error, L"GQCS FALSE, GetLastError() = %d, WSAGetLastError() = %d", errorCode, ::WSAGetLastError());
-				CrashDump::Crash();
-			}
-			break;
+				//   -  ġ ٸ Ŀ  ȣ ´ٸ ǵ ´
+				if (bThreadExit)
+				{
+					::PostQueuedCompletionStatus(iocp, 0, 0, 0);
+				}
+
+				bThreadExit = true;
+				continue;
 			}
 
-			//   ó
+			netServer->processIocpCompletion(session, overlapped, entries[i].dwNumberOfBytesTransferred);
+		}
 
-			goto DECREMENT_IO_COUNT;
-		}
+		// ġ  Ƶ ͸ īƮ   ݿ
+		netServer->flushMonitoringCounts();
+	}
 
-		// Process Disconnect & Send & Recv
-		if (overlapped == &session->SendOverlapped)
+	LOGF(ELogLevel::System, L"IOCP Worker Thread End (ID : %d)", ::GetCurrentThreadId());
+
+	return 0;
+}
+
+void NetServer::processIocpCompletion(Session* session, OVERLAPPED* overlapped, const DWORD transferredBytes)
+{
+	//  I/O - GQCS FALSE ϴ 
+	if (overlapped->Internal != 0)
+	{
+		DWORD flags = 0;
+		DWORD bytes = 0;
+		::WSAGetOverlappedResult(session->Socket, overlapped, &bytes, FALSE, &flags);
+
+		int errorCode = ::WSAGetLastError();
+
+		switch (errorCode)
+		{
+		case WSAETIMEDOUT:
 		{
-			// release registered packets
-			uint32_t registeredPacketsCount = session->RegisteredPacketCount;
-			session->RegisteredPacketCount = 0;
+			LOGF(ELogLevel::Debug, L"I/O failed, WSAGetLastError() = %d (TIMEDOUT) -> disconnect", errorCode);
+		}
+		break;
+		case WSAECONNRESET:
+		case WSAECONNABORTED:
+		case WSA_OPERATION_ABORTED:
+			break;
+		default:
+		{
+			LOGF(ELogLevel::Error, L"I/O failed, WSAGetLastError() = %d", errorCode);
+			CrashDump::Crash();
+		}
+		break;
+		}
 
-			InterlockedAdd64(reinterpret_cast<LONG64*>(&netServer->mMonitoringVariables.SendMessageTPS), registeredPacketsCount);
+		//   ó
 
-			for (uint32_t i = 0; i < registeredPacketsCount; ++i)
-			{
-				session->RegisteredPackets[i]->DecrementRefCount();
-			}
+		goto DECREMENT_IO_COUNT;
+	}
+
+	// Process Disconnect & Send & Recv
+	if (overlapped == &session->SendOverlapped)
+	{
+		// release registered packets
+		session->releaseRegisteredPackets();
+
+		addMonitoringCount(EMonitoringCounter::SendCall);
+		addMonitoringCount(EMonitoringCounter::SendBytes, transferredBytes);
 
+		if (session->bDisconnectRegistered)
+		{
+			goto DECREMENT_IO_COUNT;
+		}
+
+		ASSERT_LIVE(InterlockedExchange(&session->bSendFlag, 0) == 1, L"more than 1 Send Error");
+
+		session->PostSend();
+	}
+	else if (overlapped == &session->RecvOverlapped)
+	{
+		// 0Ʈ  Ϸ - (Ǵ  ) ߴٴ ̹Ƿ ۸ ͼ   Ǵ
+		if (session->RecvBuffer == nullptr)
+		{
 			if (session->bDisconnectRegistered)
 			{
 				goto DECREMENT_IO_COUNT;
 			}
 
-			ASSERT_LIVE(InterlockedExchange(&session->bSendFlag, 0) == 1, L"more than 1 Send Error");
+			session->acquireRecvBuffer();
+			session->PostRecv();
+
+			goto DECREMENT_IO_COUNT;
+		}
+
+		session->RecvBuffer->MoveRear(transferredBytes);
 
-			session->PostSend();
+		//  
+		if (transferredBytes == 0 || session->bDisconnectRegistered)
+		{
+			goto DECREMENT_IO_COUNT;
 		}
-		else if (overlapped == &session->RecvOverlapped)
+
+		if (false == processReceivedPackets(session))
 		{
-			session->RecvBuffer.MoveRear(transferredBytes);
+			goto DECREMENT_IO_COUNT;
+		}
+
+		//  Ͱ ٸ ۸ Ǯ ְ 0Ʈ  Ǵ
+		session->releaseRecvBufferIfEmpty();
+
+		// Post Recv
+		session->PostRecv();
+	}
+	else
+	{
+		ASSERT_LIVE(false, L"Invalid OVERLAPPED");
+	}
+
 
-			//  
-			if (transferredBytes == 0 || session->bDisconnectRegistered)
+DECREMENT_IO_COUNT:
+
+	// ̹    IoCount 1 ν    ϴ ڵ
+	session->DecrementIoCount();
+}
+
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+
+unsigned int NetServer::epollWorkerThread(void* netServerParam)
+{
+	LOGF(ELogLevel::System, L"epoll Worker Thread Start (ID : %d)", ::GetCurrentThreadId());
+
+	NetServer* netServer = reinterpret_cast<NetServer*>(netServerParam);
+
+	//    Ŀ  epoll 
+	uint32_t shardIndex = (InterlockedIncrement(&netServer->mBoundIoShardCount) - 1) % netServer->mIoShardCount;
+	int epoll = netServer->mEpolls[shardIndex];
+
+	beginMonitoringBatch();
+
+	epoll_event events[EPOLL_MAX_EVENT_COUNT];
+
+	while (netServer->mbIsRunning)
+	{
+		int eventCount = ::epoll_wait(epoll, events, EPOLL_MAX_EVENT_COUNT, -1);
+
+		if (eventCount == -1)
+		{
+			int errorCode = errno;
+			if (errorCode == EINTR)
 			{
-				goto DECREMENT_IO_COUNT;
+				continue;
 			}
 
-			// packet loop
-			while (true)
+			LOGF(ELogLevel::Error, L"epoll_wait() failed, errno = %d", errorCode);
+			CrashDump::Crash();
+		}
+
+		for (int i = 0; i < eventCount; ++i)
+		{
+			const uint64_t sessionID = events[i].data.u64;
+			const uint32_t triggeredEvents = events[i].events;
+
+			if (sessionID == NOTIFY_EVENT_KEY)
 			{
-				// 1. header check
-				if (session->RecvBuffer.GetUseSize() < sizeof(NetworkHeader))
+				if (false == netServer->mbIsRunning)
 				{
+					//   - ȣ  ʾƾ ٸ Ŀ鵵 
 					break;
 				}
 
-				bool retPeek = session->RecvBuffer.Peek(reinterpret_cast<char*>(&header), sizeof(header));
-				ASSERT_LIVE(retPeek == true, L"RecvBuffer Peek() Error");
+				// OnRelease û ó
+				NetUtils::ClearNotifyEvent(netServer->mNotifyEvent);
 
-#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
-				// NetServer - code check
-				if (header.Code != NETWORK_HEADER_CODE)
+				uint64_t releasedSessionID;
+				while (netServer->mReleaseQueue.TryDequeue(releasedSessionID))
 				{
-					goto DECREMENT_IO_COUNT;
+					netServer->OnRelease(releasedSessionID);
 				}
-#endif
 
-				// 2. header Length check
-				if (header.Length > netServer->GetMaxPayloadLength())
-				{
-					goto DECREMENT_IO_COUNT;
-				}
+				continue;
+			}
 
-				// 3. payload check
-				if (session->RecvBuffer.GetUseSize() < sizeof(NetworkHeader) + header.Length)
-				{
-					if (session->RecvBuffer.GetFreeSize() <= 0)
-					{
-						goto DECREMENT_IO_COUNT;
-					}
+			// IOCP ޸  IoCount   Ƿ ⼭  ´
+			Session* session = netServer->findSessionOrNull(sessionID);
+			if (session == nullptr)
+			{
+				continue;
+			}
 
-					break;
-				}
+			int32_t retIoCount = static_cast<int32_t>(session->IncrementIoCount());
+
+			if (retIoCount < 0 || session->bDisconnected || session->ID != sessionID)
+			{
+				session->DecrementIoCount();
+				continue;
+			}
+
+			if (triggeredEvents & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR))
+			{
+				session->ProcessRecvEvent();
+			}
 
-				// 4. packet copy
-				Serializer* packet = Serializer::l_packetPool.Alloc();
-				packet->IncrementRefCount();
-				packet->Clear();
+			if (triggeredEvents & (EPOLLOUT | EPOLLHUP | EPOLLERR))
+			{
+				session->ProcessSendEvent();
+			}
 
-				bool retDequeue = session->RecvBuffer.Dequeue(packet->GetFullBufferPointer(), header.Length + sizeof(NetworkHeader));
-				ASSERT_LIVE(retDequeue == true, L"RecvBuffer Dequeue() Error");
-				packet->SetUseSize(header.Length);
+			session->DecrementIoCount();
+		}
 
-#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
-				// NetServer - decode packet
-				if (false == packet->decode())
+		// ġ  Ƶ ͸ īƮ   ݿ
+		netServer->flushMonitoringCounts();
+	}
+
+	LOGF(ELogLevel::System, L"epoll Worker Thread End (ID : %d)", ::GetCurrentThreadId());
+
+	return 0;
+}
+
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+
+unsigned int NetServer::uringWorkerThread(void* netServerParam)
+{
+	LOGF(ELogLevel::System, L"io_uring Worker Thread Start (ID : %d)", ::GetCurrentThreadId());
+
+	NetServer* netServer = reinterpret_cast<NetServer*>(netServerParam);
+
+	uint32_t shardIndex = InterlockedIncrement(&netServer->mBoundIoShardCount) - 1;
+	IoUring& ring = netServer->mRings[shardIndex];
+	ring.BindOwnerThread();
+	beginMonitoringBatch();
+
+	io_uring_cqe completion;
+	bool bThreadExit = false;
+
+	while (false == bThreadExit)
+	{
+		//   Ƶ SQE  + Ϸ ⸦   ý ݷ ó
+		ring.SubmitAndWait(1);
+
+		while (ring.TryPopCompletion(&completion))
+		{
+			EIoUringOperation operation = IoUring::GetOperation(completion.user_data);
+
+			if (operation == EIoUringOperation::Notify)
+			{
+				if (false == netServer->mbIsRunning)
 				{
-					packet->DecrementRefCount();
-					goto DECREMENT_IO_COUNT;
+					//   -  Ż
+					bThreadExit = true;
+					break;
 				}
-#endif
 
-				// 5. OnReceive()
-				netServer->OnReceive(session->ID, packet);
+				// OnRelease û ó
+				uint64_t releasedSessionID;
+				while (netServer->mReleaseQueue.TryDequeue(releasedSessionID))
+				{
+					netServer->OnRelease(releasedSessionID);
+				}
 
-				InterlockedIncrement(&netServer->mMonitoringVariables.RecvMessageTPS);
+				continue;
 			}
 
-			// Post Recv
-			session->PostRecv();
-		}
-		else
-		{
-			ASSERT_LIVE(false, L"Invalid OVERLAPPED");
-		}
+			// ɷִ ۾ IoCount  Ƿ     ʴ´
+			Session* session = reinterpret_cast<Session*>(IoUring::GetContext(completion.user_data));
 
+			session->IncrementIoCount();
 
-	DECREMENT_IO_COUNT:
+			if (operation == EIoUringOperation::Recv)
+			{
+				session->ProcessRecvCompletion(completion.res, completion.flags);
+			}
+			else
+			{
+				session->ProcessSendCompletion(completion.res);
+			}
 
-		// ̹    IoCount 1 ν    ϴ ڵ
-		session->DecrementIoCount();
+			session->DecrementIoCount();
+		}
+
+		// ġ  Ƶ ͸ īƮ   ݿ
+		netServer->flushMonitoringCounts();
 	}
 
-	LOGF(ELogLevel::System, L"IOCP Worker Thread End (ID : %d)", ::GetCurrentThreadId());
+	LOGF(ELogLevel::System, L"io_uring Worker Thread End (ID : %d)", ::GetCurrentThreadId());
 
 	return 0;
 }
 
+#endif
+
+void NetServer::flushMonitoringCounts(void)
+{
+	for (int i = 0; i < static_cast<int>(EMonitoringCounter::Count); ++i)
+	{
+		uint32_t count = l_monitoringBatch.Counts[i];
+		if (count == 0)
+		{
+			continue;
+		}
+
+		InterlockedAdd(reinterpret_cast<LONG*>(getMonitoringVariable(static_cast<EMonitoringCounter>(i))), count);
+		l_monitoringBatch.Counts[i] = 0;
+	}
+}
+
+uint32_t* NetServer::getMonitoringVariable(const EMonitoringCounter counter)
+{
+	switch (counter)
+	{
+	case EMonitoringCounter::RecvMessage:
+		return &mMonitoringVariables.RecvMessageTPS;
+	case EMonitoringCounter::SendMessage:
+		return &mMonitoringVariables.SendMessageTPS;
+	case EMonitoringCounter::RecvPending:
+		return &mMonitoringVariables.RecvPendingTPS;
+	case EMonitoringCounter::SendPending:
+		return &mMonitoringVariables.SendPendingTPS;
+	case EMonitoringCounter::SendCall:
+		return &mMonitoringVariables.SendCallTPS;
+	case EMonitoringCounter::SendBytes:
+		return &mMonitoringVariables.SendBytesTPS;
+	case EMonitoringCounter::SendDropNewest:
+		return &mMonitoringVariables.SendDropNewestTPS;
+	case EMonitoringCounter::SendDropOldest:
+		return &mMonitoringVariables.SendDropOldestTPS;
+	case EMonitoringCounter::SendOverflowDisconnect:
+		return &mMonitoringVariables.SendOverflowDisconnectTPS;
+	case EMonitoringCounter::IpConnectionReject:
+		return &mMonitoringVariables.IpConnectionRejectTPS;
+	case EMonitoringCounter::IpConnectRateReject:
+		return &mMonitoringVariables.IpConnectRateRejectTPS;
+	case EMonitoringCounter::RecvRateViolation:
+		return &mMonitoringVariables.RecvRateViolationTPS;
+	default:
+		ASSERT_LIVE(false, L"Invalid EMonitoringCounter");
+		return nullptr;
+	}
+}
+
 unsigned int NetServer::monitorThread(void* netServerParam)
 {
 	LOGF(ELogLevel::System, L"Monitor Thread Start (ID : %d)", ::GetCurrentThreadId());
@@ -533,6 +1116,8 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 	uint64_t sumSendMessageTPS = 0;
 	uint64_t sumRecvPendingTPS = 0;
 	uint64_t sumSendPendingTPS = 0;
+	uint64_t sumSendCallTPS = 0;
+	uint64_t sumSendBytesTPS = 0;
 
 	uint64_t sumCount = 0;
 
@@ -540,6 +1125,9 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 	{
 		::Sleep(1'000);
 
+		//  Ⱓ   Ű ֱ ش -  Ű ִ ȿ  Ű ׿ ʵ
+		netServer->reclaimSessionKeys();
+
 		// CPU 
 		cpuTime.UpdateCpuTime();
 		netServer->mMonitorResult.ProcessorTimeTotal = cpuTime.GetProcessorTimeTotal();
@@ -555,6 +1143,14 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 		netServer->mMonitorResult.SendMessageTPS = netServer->mMonitoringVariables.SendMessageTPS;
 		netServer->mMonitorResult.RecvPendingTPS = netServer->mMonitoringVariables.RecvPendingTPS;
 		netServer->mMonitorResult.SendPendingTPS = netServer->mMonitoringVariables.SendPendingTPS;
+		netServer->mMonitorResult.SendCallTPS = netServer->mMonitoringVariables.SendCallTPS;
+		netServer->mMonitorResult.SendBytesTPS = netServer->mMonitoringVariables.SendBytesTPS;
+		netServer->mMonitorResult.SendDropNewestTPS = netServer->mMonitoringVariables.SendDropNewestTPS;
+		netServer->mMonitorResult.SendDropOldestTPS = netServer->mMonitoringVariables.SendDropOldestTPS;
+		netServer->mMonitorResult.SendOverflowDisconnectTPS = netServer->mMonitoringVariables.SendOverflowDisconnectTPS;
+		netServer->mMonitorResult.IpConnectionRejectTPS = netServer->mMonitoringVariables.IpConnectionRejectTPS;
+		netServer->mMonitorResult.IpConnectRateRejectTPS = netServer->mMonitoringVariables.IpConnectRateRejectTPS;
+		netServer->mMonitorResult.RecvRateViolationTPS = netServer->mMonitoringVariables.RecvRateViolationTPS;
 
 		// Avg TPS
 		sumAcceptTPS += netServer->mMonitorResult.AcceptTPS;
@@ -562,6 +1158,8 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 		sumSendMessageTPS += netServer->mMonitorResult.SendMessageTPS;
 		sumRecvPendingTPS += netServer->mMonitorResult.RecvPendingTPS;
 		sumSendPendingTPS += netServer->mMonitorResult.SendPendingTPS;
+		sumSendCallTPS += netServer->mMonitorResult.SendCallTPS;
+		sumSendBytesTPS += netServer->mMonitorResult.SendBytesTPS;
 		sumCount++;
 
 		netServer->mMonitorResult.AverageAcceptTPS = static_cast<uint32_t>(sumAcceptTPS / sumCount);
@@ -569,6 +1167,8 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 		netServer->mMonitorResult.AverageSendMessageTPS = static_cast<uint32_t>(sumSendMessageTPS / sumCount);
 		netServer->mMonitorResult.AverageRecvPendingTPS = static_cast<uint32_t>(sumRecvPendingTPS / sumCount);
 		netServer->mMonitorResult.AverageSendPendingTPS = static_cast<uint32_t>(sumSendPendingTPS / sumCount);
+		netServer->mMonitorResult.AverageSendCallTPS = static_cast<uint32_t>(sumSendCallTPS / sumCount);
+		netServer->mMonitorResult.AverageSendBytesTPS = static_cast<uint32_t>(sumSendBytesTPS / sumCount);
 
 		// ͸  ʱȭ
 		netServer->mMonitoringVariables.AcceptTPS = 0;
@@ -576,6 +1176,14 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 		netServer->mMonitoringVariables.SendMessageTPS = 0;
 		netServer->mMonitoringVariables.RecvPendingTPS = 0;
 		netServer->mMonitoringVariables.SendPendingTPS = 0;
+		netServer->mMonitoringVariables.SendCallTPS = 0;
+		netServer->mMonitoringVariables.SendBytesTPS = 0;
+		netServer->mMonitoringVariables.SendDropNewestTPS = 0;
+		netServer->mMonitoringVariables.SendDropOldestTPS = 0;
+		netServer->mMonitoringVariables.SendOverflowDisconnectTPS = 0;
+		netServer->mMonitoringVariables.IpConnectionRejectTPS = 0;
+		netServer->mMonitoringVariables.IpConnectRateRejectTPS = 0;
+		netServer->mMonitoringVariables.RecvRateViolationTPS = 0;
 	}
 
 	LOGF(ELogLevel::System, L"Monitor Thread End (ID : %d)", ::GetCurrentThreadId());
@@ -583,6 +1191,234 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 	return 0;
 }
 
+void NetServer::createListenSockets(void)
+{
+#ifdef _WIN32
+	// SO_REUSEPORT  -  Accept 尡 ϳ  Ͽ acceptѴ
+	mListenSocketCount = 1;
+#else
+	mListenSocketCount = mAcceptThreadCount;
+#endif
+	mBoundListenSocketCount = 0;
+	mListenSockets = new SOCKET[mListenSocketCount];
+
+	for (uint32_t i = 0; i < mListenSocketCount; ++i)
+	{
+		// create socket
+		SOCKET listenSocket = NetUtils::CreateSocket();
+
+		// socket option - accept    ɼ ӹǷ Ǹ  ʴ´
+		NetUtils::SetLinger(listenSocket, 1, 0);
+
+		if (mbIsSendBufferSizeZero)
+		{
+			NetUtils::SetSendBufferSize(listenSocket, 0);
+		}
+
+		if (mbIsTcpNodelay)
+		{
+			NetUtils::SetTcpNodelay(listenSocket);
+		}
+
+		//  ϵ    Ƿ α״ ù ϸ 
+		applySocketTuningProfile(listenSocket, i == 0);
+
+		//   Ƽ ޱ  ŷ д
+		NetUtils::SetNonBlocking(listenSocket);
+
+#ifndef _WIN32
+		if (mListenSocketCount > 1)
+		{
+			NetUtils::SetReusePort(listenSocket);
+		}
+#endif
+
+		// bind
+		NetUtils::BindSocket(listenSocket, mPort);
+
+		// listen
+		NetUtils::SetSocketListen(listenSocket);
+
+		mListenSockets[i] = listenSocket;
+	}
+}
+
+void NetServer::applySocketTuningProfile(const SOCKET listenSocket, const bool bLogResult)
+{
+	const SocketTuningProfile& profile = mSocketTuningProfile;
+
+	if (profile.RecvBufferSize > 0)
+	{
+		NetUtils::SetReceiveBufferSize(listenSocket, static_cast<int>(profile.RecvBufferSize));
+	}
+
+	if (profile.SendBufferSize > 0 && false == mbIsSendBufferSizeZero)
+	{
+		NetUtils::SetSendBufferSize(listenSocket, static_cast<int>(profile.SendBufferSize));
+	}
+
+	// keepalive, NOTSENT_LOWAT, BUSY_POLL  ʴ ȯ(, Ŀ )  Ƿ   ʰ α׸ 
+	bool bKeepAliveApplied = false;
+	if (profile.KeepAliveIdleSec > 0)
+	{
+		bKeepAliveApplied = NetUtils::SetKeepAlive(listenSocket, static_cast<int>(profile.KeepAliveIdleSec),
+			static_cast<int>(profile.KeepAliveIntervalSec), static_cast<int>(profile.KeepAliveProbeCount));
+
+		if (false == bKeepAliveApplied)
+		{
+			LOGF(ELogLevel::Error, L"Socket Tuning - keepalive failed (errorCode = %d)", ::WSAGetLastError());
+		}
+	}
+
+#ifndef _WIN32
+	bool bNotSentLowatApplied = false;
+	if (profile.NotSentLowat > 0)
+	{
+		bNotSentLowatApplied = NetUtils::SetNotSentLowat(listenSocket, static_cast<int>(profile.NotSentLowat));
+
+		if (false == bNotSentLowatApplied)
+		{
+			LOGF(ELogLevel::Error, L"Socket Tuning - TCP_NOTSENT_LOWAT failed (errorCode = %d)", ::WSAGetLastError());
+		}
+	}
+
+	// net.core.busy_read ū  CAP_NET_ADMIN ʿϴ
+	bool bBusyPollApplied = false;
+	if (profile.BusyPollUs > 0)
+	{
+		bBusyPollApplied = NetUtils::SetBusyPoll(listenSocket, static_cast<int>(profile.BusyPollUs));
+
+		if (false == bBusyPollApplied)
+		{
+			LOGF(ELogLevel::Error, L"Socket Tuning - SO_BUSY_POLL failed (errorCode = %d)", ::WSAGetLastError());
+		}
+	}
+#endif
+
+	if (false == bLogResult)
+	{
+		return;
+	}
+
+	//  ũ OS     (Linux û ũ 2踦 ´)
+	LOGF(ELogLevel::System, L"Socket Tuning : SO_RCVBUF = %d (requested %u), SO_SNDBUF = %d (requested %u)",
+		NetUtils::GetReceiveBufferSize(listenSocket), profile.RecvBufferSize,
+		NetUtils::GetSendBufferSize(listenSocket), mbIsSendBufferSizeZero ? 0 : profile.SendBufferSize);
+
+	if (bKeepAliveApplied)
+	{
+		LOGF(ELogLevel::System, L"Socket Tuning : keepalive idle = %us, interval = %us, probes = %u (0 = OS default)",
+			profile.KeepAliveIdleSec, profile.KeepAliveIntervalSec, profile.KeepAliveProbeCount);
+	}
+	else
+	{
+		LOGF(ELogLevel::System, L"Socket Tuning : keepalive off");
+	}
+
+#ifdef _WIN32
+	if (profile.bQuickAck || profile.NotSentLowat > 0 || profile.BusyPollUs > 0)
+	{
+		LOGF(ELogLevel::System, L"Socket Tuning : TCP_QUICKACK, TCP_NOTSENT_LOWAT, SO_BUSY_POLL are Linux only - ignored");
+	}
+#else
+	LOGF(ELogLevel::System, L"Socket Tuning : TCP_QUICKACK = %ls, TCP_NOTSENT_LOWAT = %u%ls, SO_BUSY_POLL = %uus%ls",
+		profile.bQuickAck ? L"on (per accepted socket)" : L"off",
+		profile.NotSentLowat, (profile.NotSentLowat > 0 && false == bNotSentLowatApplied) ? L" (failed)" : L"",
+		profile.BusyPollUs, (profile.BusyPollUs > 0 && false == bBusyPollApplied) ? L" (failed)" : L"");
+#endif
+}
+
+bool NetServer::acceptSession(const SOCKET clientSocket, const SOCKADDR_IN& clientAddress)
+{
+	uint32_t newSessionKey;			// ο  Key (  ü )
+	bool bIpTracked = false;		// IP   °
+
+	// IP   -    Ÿ
+	if (mIpConnectionTable.IsInitialized())
+	{
+		switch (mIpConnectionTable.TryAddConnection(clientAddress.sin_addr.s_addr, ::timeGetTime(), mMaxConnectionsPerIp, mMaxConnectsPerIpPerSecond))
+		{
+		case IpConnectionTable::EResult::Accepted:
+			bIpTracked = true;
+			break;
+		case IpConnectionTable::EResult::Untracked:
+			break;
+		case IpConnectionTable::EResult::TooManyConnections:
+			NetUtils::CloseSocket(clientSocket);
+			addMonitoringCount(EMonitoringCounter::IpConnectionReject);
+			return false;
+		case IpConnectionTable::EResult::TooFrequent:
+			NetUtils::CloseSocket(clientSocket);
+			addMonitoringCount(EMonitoringCounter::IpConnectRateReject);
+			return false;
+		}
+	}
+
+	// ǸƮκ  ´ -  Ű ٸ  Ⱓ  Ű ȸغ, ׷ ٸ  ̺ ÷ ٽ õѴ
+	bool bPopSuccess = mUnusedSessionKeys.TryPop(newSessionKey);
+
+	if (false == bPopSuccess && reclaimSessionKeys())
+	{
+		bPopSuccess = mUnusedSessionKeys.TryPop(newSessionKey);
+	}
+
+	if (false == bPopSuccess && growSessionTable())
+	{
+		bPopSuccess = mUnusedSessionKeys.TryPop(newSessionKey);
+	}
+
+	if (false == bPopSuccess)
+	{
+		if (bIpTracked)
+		{
+			mIpConnectionTable.RemoveConnection(clientAddress.sin_addr.s_addr);
+		}
+
+		NetUtils::CloseSocket(clientSocket);
+		LOGF(ELogLevel::System, L"Max Session Count - Session Disconnected");
+
+		return false;
+	}
+
+#ifndef _WIN32
+	// TCP_QUICKACK  Ͽ ӵ Ƿ accept ϸ Ѵ
+	if (mSocketTuningProfile.bQuickAck)
+	{
+		NetUtils::SetQuickAck(clientSocket);
+	}
+#endif
+
+	// ο  ID 
+	uint64_t newSessionID = (InterlockedIncrement(&mSessionAcceptedCount) & (0x0000'0000'FFFF'FFFFULL)) | (static_cast<uint64_t>(newSessionKey) << 32);
+
+	//  
+	Session* newSession = &mSessionBlocks[newSessionKey >> SESSION_BLOCK_SHIFT][newSessionKey & (SESSION_BLOCK_SIZE - 1)];
+
+	newSession->IncrementIoCount();
+
+	newSession->Init(clientSocket, clientAddress, this, newSessionID, newSessionKey);
+	newSession->bIpTracked = bIpTracked;
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+	NetUtils::RegisterIOCP(clientSocket, mIOCPs[getIoShardIndex(newSessionKey)], reinterpret_cast<ULONG_PTR>(newSession));
+#endif
+
+	// accept log
+	//LOGF(ELogLevel::Debug, L"Accept - %s:%d", NetUtils::GetIpAddress(newSession->Address).c_str(), NetUtils::GetPortNumber(newSession->Address));
+
+	// monitoring
+	InterlockedIncrement(&mSessionCount);
+
+	OnAccept(newSession->ID);
+
+	// epoll  ⼭ epoll ϵǰ, io_uring  multishot recv ɸ
+	newSession->PostRecv();
+
+	newSession->DecrementIoCount();
+
+	return true;
+}
+
 Session* NetServer::findSessionOrNull(const uint64_t sessionID) const
 {
 	uint32_t sessionKey = sessionID >> 32;
@@ -592,5 +1428,255 @@ Session* NetServer::findSessionOrNull(const uint64_t sessionID) const
 		return nullptr;
 	}
 
-	return mSessionList + sessionKey;
-}
\ No newline at end of file
+	//  ʹ Ű ֱ  ϵǰ Shutdown()  ٲ Ƿ   д´
+	Session* sessionBlock = mSessionBlocks[sessionKey >> SESSION_BLOCK_SHIFT];
+
+	if (sessionBlock == nullptr)
+	{
+		return nullptr;
+	}
+
+	return sessionBlock + (sessionKey & (SESSION_BLOCK_SIZE - 1));
+}
+
+bool NetServer::growSessionTable(void)
+{
+	::AcquireSRWLockExclusive(&mSessionTableLock);
+
+	//  ٸ  ٸ Accept 尡 ÷Ȱų  ݳǾ
+	if (false == mUnusedSessionKeys.IsEmpty())
+	{
+		::ReleaseSRWLockExclusive(&mSessionTableLock);
+		return true;
+	}
+
+	if (mSessionBlockCount == mMaxSessionBlockCount)
+	{
+		::ReleaseSRWLockExclusive(&mSessionTableLock);
+		return false;
+	}
+
+	// Session ĳ   ĵǾ ־ ̿ ǳ ĳ    ʴ´
+	uint32_t blockIndex = mSessionBlockCount;
+	uint32_t firstKey = blockIndex * SESSION_BLOCK_SIZE;
+	Session* sessionBlock = new Session[SESSION_BLOCK_SIZE];
+
+	//  SendSlab    (io_uring̶  ϳ     ĭ)
+	char* sendSlabBlock = nullptr;
+
+	if (mSendCoalescingSize > 0)
+	{
+		sendSlabBlock = new char[static_cast<size_t>(SESSION_BLOCK_SIZE) * Session::SEND_SLAB_SIZE];
+		mSendSlabBlocks[blockIndex] = sendSlabBlock;
+	}
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	uint16_t sendSlabBufferIndex = registerSendSlabBlock(blockIndex, sendSlabBlock) ? static_cast<uint16_t>(blockIndex) : Session::NO_FIXED_BUFFER;
+#endif
+
+	for (uint32_t i = 0; i < SESSION_BLOCK_SIZE; ++i)
+	{
+		//       д - Release Flag ٸ Disconnect()  Ҵ   Ų
+		sessionBlock[i].IoCount = 0x8000'0000;
+		sessionBlock[i].bDisconnected = true;
+
+		if (sendSlabBlock != nullptr)
+		{
+			sessionBlock[i].SendSlab = sendSlabBlock + static_cast<size_t>(i) * Session::SEND_SLAB_SIZE;
+		}
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+		sessionBlock[i].SendSlabBufferIndex = sendSlabBufferIndex;
+#endif
+	}
+
+	mSessionBlocks[blockIndex] = sessionBlock;
+	InterlockedIncrement(&mSessionBlockCount);
+
+	//   ִ   Ѵ Ű  ʴ´ ( Ű ־  Ű ̰ Ѵ)
+	uint32_t lastKey = std::min(firstKey + SESSION_BLOCK_SIZE, mMaxSessionCount);
+
+	for (uint32_t key = lastKey; key > firstKey; --key)
+	{
+		mUnusedSessionKeys.Push(key - 1);
+	}
+
+	::ReleaseSRWLockExclusive(&mSessionTableLock);
+
+	return true;
+}
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+bool NetServer::registerSendSlabBlock(const uint32_t blockIndex, char* sendSlabBlock)
+{
+	if (sendSlabBlock == nullptr)
+	{
+		return false;
+	}
+
+	for (uint32_t i = 0; i < mIoShardCount; ++i)
+	{
+		if (false == mRings[i].RegisterFixedBuffer(blockIndex, sendSlabBlock, static_cast<size_t>(SESSION_BLOCK_SIZE) * Session::SEND_SLAB_SIZE))
+		{
+			//    ǵ    Ϻ  ϵ ä  ʴ´ -   sendmsg 
+			for (uint32_t j = 0; j < i; ++j)
+			{
+				mRings[j].UnregisterFixedBuffer(blockIndex);
+			}
+
+			return false;
+		}
+	}
+
+	return true;
+}
+#endif
+
+void NetServer::retireSessionKey(const uint32_t sessionKey)
+{
+	// Release Flag bDisconnected  ڿ ũ ÷ Ŀ  б     ʴ´
+	mRetiredSessionKeys.Enqueue({ sessionKey, mSessionEpoch.Retire() });
+}
+
+bool NetServer::reclaimSessionKeys(void)
+{
+	::AcquireSRWLockExclusive(&mRetiredSessionKeyLock);
+
+	RetiredSessionKey retiredSessionKey;
+	while (mRetiredSessionKeys.TryDequeue(retiredSessionKey))
+	{
+		mGraceSessionKeys.push_back(retiredSessionKey);
+	}
+
+	//   б    Ű鸸 ش ( 尡 Ƿ ũ     , ʰ  ̴)
+	const int64_t minActiveEpoch = mSessionEpoch.GetMinActiveEpoch();
+	bool bReclaimed = false;
+
+	while (false == mGraceSessionKeys.empty() && mGraceSessionKeys.front().Epoch <= minActiveEpoch)
+	{
+		mUnusedSessionKeys.Push(mGraceSessionKeys.front().Key);
+		mGraceSessionKeys.pop_front();
+		bReclaimed = true;
+	}
+
+	::ReleaseSRWLockExclusive(&mRetiredSessionKeyLock);
+
+	return bReclaimed;
+}
+
+uint32_t NetServer::GetSessionTableCapacity(void) const
+{
+	return std::min(mSessionBlockCount * SESSION_BLOCK_SIZE, mMaxSessionCount);
+}
+
+bool NetServer::processReceivedPackets(Session* session)
+{
+	NetworkHeader header;
+
+	const bool bIsRecvRateLimited = (mMaxRecvPacketsPerSecond > 0 || mMaxRecvBytesPerSecond > 0);
+
+	if (bIsRecvRateLimited)
+	{
+		session->RefillRecvTokens(::timeGetTime());
+	}
+
+	// packet loop
+	while (true)
+	{
+		// 1. header check
+		if (session->RecvBuffer->GetUseSize() < sizeof(NetworkHeader))
+		{
+			break;
+		}
+
+		bool retPeek = session->RecvBuffer->Peek(reinterpret_cast<char*>(&header), sizeof(header));
+		ASSERT_LIVE(retPeek == true, L"RecvBuffer Peek() Error");
+
+#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
+		// NetServer - code check
+		if (header.Code != NETWORK_HEADER_CODE)
+		{
+			return false;
+		}
+#elif NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET_STREAM
+		// NetServer - code check, ù Ŷ ڵ   ȣȭ  Ѵ ( Ŭ̾Ʈ NETWORK_HEADER_CODE)
+		if (session->RecvHeaderCode == 0)
+		{
+			if (header.Code == NETWORK_HEADER_STREAM_CODE)
+			{
+				session->Cipher.store(ENetworkCipher::Stream, std::memory_order_release);
+			}
+			else if (header.Code != NETWORK_HEADER_CODE)
+			{
+				return false;
+			}
+
+			session->RecvHeaderCode = header.Code;
+		}
+
+		//  ڿ  ٲ  
+		if (header.Code != session->RecvHeaderCode)
+		{
+			return false;
+		}
+#endif
+
+		// 2. header Length check
+		if (header.Length > GetMaxPayloadLength())
+		{
+			return false;
+		}
+
+		// 3. payload check
+		if (session->RecvBuffer->GetUseSize() < sizeof(NetworkHeader) + header.Length)
+		{
+			if (session->RecvBuffer->GetFreeSize() <= 0)
+			{
+				return false;
+			}
+
+			break;
+		}
+
+		const int packetSize = static_cast<int>(sizeof(NetworkHeader) + header.Length);
+
+		// 4. recv rate check - Ǻ ū Ŷ (Ŷ , Ʈ )
+		if (bIsRecvRateLimited && false == session->ConsumeRecvTokens(packetSize))
+		{
+			addMonitoringCount(EMonitoringCounter::RecvRateViolation);
+			return false;
+		}
+
+		// 5. packet view - Ŷ RecvBuffer  ߷   ̾ ٿ Ѵ (MirroredRingBuffer ߸ )
+		char* packetPointer;
+
+		if (session->RecvBuffer->GetDirectDequeueSize() >= packetSize)
+		{
+			packetPointer = session->RecvBuffer->GetFrontBufferPtr();
+		}
+		else
+		{
+			packetPointer = l_wrappedPacketBuffer;
+
+			retPeek = session->RecvBuffer->Peek(packetPointer, packetSize);
+			ASSERT_LIVE(retPeek == true, L"RecvBuffer Peek() Error");
+		}
+
+#if NETWORK_HEADER_USE_TYPE != NETWORK_HEADER_TYPE_LAN
+		// NetServer - decode packet (ڸ ڵ)
+		if (false == Serializer::decode(packetPointer))
+		{
+			return false;
+		}
+#endif
+
+		// 6. OnReceive() -  ڿ RecvBuffer 
+		PacketView packet(packetPointer + sizeof(NetworkHeader), header.Length);
+		OnReceive(session->ID, packet);
+
+		session->RecvBuffer->MoveFront(packetSize);
+
+		addMonitoringCount(EMonitoringCounter::RecvMessage);
+	}
+
+	return true;
+}
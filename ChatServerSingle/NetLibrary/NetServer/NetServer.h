@@ -1,9 +1,18 @@
 #pragma once
 
+#include <deque>
 #include <string>
 
+#include "IoEngine.h"
+#include "IoUring.h"
+#include "IpConnectionTable.h"
+#include "PacketView.h"
+#include "RingBuffer.h"
 #include "Serializer.h"
+#include "SessionRecvBuffer.h"
 #include "../DataStructure/LockFreeStack.h"
+#include "../DataStructure/LockFreeQueue.h"
+#include "../Memory/EpochDomain.h"
 
 class Session;
 typedef void* HANDLE;
@@ -17,11 +26,21 @@ struct MonitoringVariables
     uint32_t SendMessageTPS;            // ʴ ޼ ۽ Ƚ
     uint32_t RecvPendingTPS;
     uint32_t SendPendingTPS;
+    uint32_t SendCallTPS;               // ʴ ۽ ý  Ƚ (WSASend Ϸ, writev, sendmsg Ϸ)
+    uint32_t SendBytesTPS;              // ʴ ۽ Ʈ 
+    uint32_t SendDropNewestTPS;         // ʴ SendQueue ѵ ʰ   Ŷ  (ESendOverflowPolicy::DropNewest)
+    uint32_t SendDropOldestTPS;         // ʴ SendQueue ѵ ʰ   Ŷ  (ESendOverflowPolicy::DropOldest)
+    uint32_t SendOverflowDisconnectTPS; // ʴ SendQueue ѵ ʰ    (ESendOverflowPolicy::Disconnect)
+    uint32_t IpConnectionRejectTPS;     // ʴ IP    ʰ   
+    uint32_t IpConnectRateRejectTPS;    // ʴ IP ʴ  Ƚ ʰ   
+    uint32_t RecvRateViolationTPS;      // ʴ  ӵ (Ŷ , Ʈ ) Ѿ   
     uint32_t AverageAcceptTPS;
     uint32_t AverageRecvMessageTPS;
     uint32_t AverageSendMessageTPS;
     uint32_t AverageRecvPendingTPS;
     uint32_t AverageSendPendingTPS;
+    uint32_t AverageSendCallTPS;
+    uint32_t AverageSendBytesTPS;
     float ProcessorTimeTotal;
     float ProcessTimeTotal;
     float ProcessorTimeUser;
@@ -29,8 +48,50 @@ struct MonitoringVariables
     float ProcessorTimeKernel;
     float ProcessTimeKernel;
 };
+
+// Ŀ 尡 Ƽ ݿϴ ͸ īƮ 
+enum class EMonitoringCounter
+{
+    RecvMessage,    // -> RecvMessageTPS
+    SendMessage,    // -> SendMessageTPS
+    RecvPending,    // -> RecvPendingTPS
+    SendPending,    // -> SendPendingTPS
+    SendCall,       // -> SendCallTPS
+    SendBytes,      // -> SendBytesTPS
+    SendDropNewest,         // -> SendDropNewestTPS
+    SendDropOldest,         // -> SendDropOldestTPS
+    SendOverflowDisconnect, // -> SendOverflowDisconnectTPS
+    IpConnectionReject,     // -> IpConnectionRejectTPS
+    IpConnectRateReject,    // -> IpConnectRateRejectTPS
+    RecvRateViolation,      // -> RecvRateViolationTPS
+
+    Count
+};
 /************************** monitoring variables **************************/
 
+//  SendQueue ѵ(SetMaxSendQueueCount, SetMaxSendQueueBytes) ɷ  ó
+enum class ESendOverflowPolicy
+{
+    DropNewest,     //   Ŷ 
+    DropOldest,     //  ۽ ϵ    Ŷ   Ŷ ִ´ (Serializer::SetDroppable ǥõ Ŷ)
+                    // տ    Ŷ ־ ڶ  Ŷ  Ǵ Ŷ  DropNewest, ƴ϶ Disconnect
+    Disconnect      //  ϴ Ŭ̾Ʈ   ´
+};
+
+//  Ͽ ϴ TCP Ʃ , accept    ӹ޴´ ( ׸ 0̸  ʰ OS ⺻)
+// 带 ٽ  ʰ config ٲ㼭  ð / ó   ϱ  
+struct SocketTuningProfile
+{
+    uint32_t RecvBufferSize;        // SO_RCVBUF (Ʈ)
+    uint32_t SendBufferSize;        // SO_SNDBUF (Ʈ, SetSendBufferSizeToZero(true) )
+    uint32_t KeepAliveIdleSec;      // TCP keepalive -    ù probe ð (0̸ keepalive   )
+    uint32_t KeepAliveIntervalSec;  // TCP keepalive - probe 
+    uint32_t KeepAliveProbeCount;   // TCP keepalive -       probe 
+    bool     bQuickAck;             // TCP_QUICKACK (Linux) -  ACK , ӵ Ƿ accept ϸ Ѵ
+    uint32_t NotSentLowat;          // TCP_NOTSENT_LOWAT (Linux, Ʈ) -    Ͱ ̺   ۽  
+    uint32_t BusyPollUs;            // SO_BUSY_POLL (Linux, ũ) -   NIC ť ٻڰ Ȯ ð
+};
+
 class NetServer
 {
     friend class Session;
@@ -54,6 +115,44 @@ public: // 
     // ޼ ִ  (ִ ̸ Ѿ ޼    ´)
     inline void SetMaxPayloadLength(const uint16_t length) { mMaxPayloadLength = length; }
 
+    //  Accept  Ŀ  ϳ  ΰ (IOCP/epoll Ŀ 帶 ϳ )
+    // io_uring  ׻ Ŀ 帶  Ƿ  ɼǰ  ȴ
+    inline void SetIoSharding(bool bToSet) { mbIsIoSharded = bToSet; }
+
+    // Accept   (⺻ 1)
+    // Linux 帶 SO_REUSEPORT   ϳ , Windows ϳ    acceptѴ
+    inline void SetAcceptThreadCount(const uint32_t count) { mAcceptThreadCount = count; }
+
+    // ۽ 1ȸ(WSASend/writev/sendmsg)  ִ   (1 ~ 64, ⺻ 64)
+    // Ǹ 10 ؼ SendQueue и   þ
+    inline void SetMaxSendBufferCount(const uint32_t count) { mMaxSendBufferCount = count; }
+
+    //  ũ( )  Ŷ Ǻ ۽ (4KB) ؼ    ϳ  (0̸   )
+    inline void SetSendCoalescingSize(const uint32_t size) { mSendCoalescingSize = size; }
+
+    // SendPacket() ٷ ۽ ʰ SendQueue ֱ⸸ ϵ  (FlushSends() ֱ ȣؾ )
+    // ۽   ۽ Ϸ   Ŷ ̾ Ƿ, FlushSends()  ִ Ǹ 
+    inline void SetDeferredSend(bool bToSet) { mbIsSendDeferred = bToSet; }
+
+    //  SendQueue ׾Ƶ  ִ ִ Ŷ  / Ʈ  (0̸  )
+    // ۽ ϵ Ŷ  ,  尡 ÿ SendPacket() ϸ  ŭ   ִ
+    inline void SetMaxSendQueueCount(const uint32_t count) { mMaxSendQueueCount = count; }
+    inline void SetMaxSendQueueBytes(const uint32_t bytes) { mMaxSendQueueBytes = bytes; }
+
+    // SendQueue ѵ ɷ  ó (⺻ DropNewest)
+    inline void SetSendOverflowPolicy(const ESendOverflowPolicy policy) { mSendOverflowPolicy = policy; }
+
+    // IP ϳ ִ    / ʴ ִ  Ƚ,  accept   ݴ´ (0̸  )
+    inline void SetMaxConnectionsPerIp(const uint32_t count) { mMaxConnectionsPerIp = count; }
+    inline void SetMaxConnectsPerIpPerSecond(const uint32_t count) { mMaxConnectsPerIpPerSecond = count; }
+
+    //  ϳ ʴ ִ  Ŷ  / Ʈ  (ū Ŷ, 1 з Ƽ   ִ),   ´ (0̸  )
+    inline void SetMaxRecvPacketsPerSecond(const uint32_t count) { mMaxRecvPacketsPerSecond = count; }
+    inline void SetMaxRecvBytesPerSecond(const uint32_t bytes) { mMaxRecvBytesPerSecond = bytes; }
+
+    //  Ͽ  TCP Ʃ  (Windows Linux  ׸ Ѵ),       α׷ 
+    inline void SetSocketTuningProfile(const SocketTuningProfile& profile) { mSocketTuningProfile = profile; }
+
     //  
     virtual void Start(
         const uint16_t port,
@@ -66,9 +165,18 @@ public: // 
 
 public: //   Լ
 
-    // Ŷ  û - SendQueue Enqueue
+    // Ŷ  û - SendQueue Enqueue ( IoCount ǵ帮 ʴ´, ۽   ۽  ´)
+    // SetDeferredSend(true) ۽  FlushSends() ̷
+    // SendQueue ѵ ɷȴٸ SetSendOverflowPolicy()  Ŷ ų  ´
     void SendPacket(const uint64_t sessionID, Serializer* packet);
 
+    //  Ŷ  ǿ  û - SendPacket() sessionCount θ Ͱ 
+    //  īƮ sessionCountŭ   ø,    ŭ    ش
+    void SendPacketToMany(const uint64_t* sessionIDs, const uint32_t sessionCount, Serializer* packet);
+
+    // SetDeferredSend(true) ,  FlushSends()  SendPacket()  ǵ ۽ Ǵ
+    void FlushSends(void);
+
     //   û
     void Disconnect(const uint64_t sessionID);
 
@@ -78,18 +186,28 @@ public: // 
     //  ּҸ ´
     bool GetSessionAddress(const uint64_t sessionID, SOCKADDR_IN* outAddress) const;
 
+    //   ޱ⸦  ( ) -   ResumeAccept()    α׿ ٸ
+    inline void PauseAccept(void) { mbIsAcceptPaused = true; }
+    inline void ResumeAccept(void) { mbIsAcceptPaused = false; }
+
 public: // Getters
 
     inline static std::wstring	GetServerVersion(void) { return L"6.7.0"; }
 
     inline bool					IsRunning(void) const { return mbIsRunning; }
+    inline bool					IsAcceptPaused(void) const { return mbIsAcceptPaused; }
     inline uint16_t				GetPortNumber(void) const { return mPort; }
     inline uint16_t				GetMaxPayloadLength(void) const { return mMaxPayloadLength; }
     inline uint64_t				GetTotalAcceptCount(void) const { return mSessionAcceptedCount; }
     inline uint64_t				GetTotalDisconnectCount(void) const { return mSessionDisconnectedCount; }
     inline MonitoringVariables	GetMonitoringInfo(void) const { return mMonitorResult; }
     inline uint32_t				GetSessionCount(void) const { return mSessionCount; }
+
+    //   Ǯ -    /    ִ  
+    inline uint32_t				GetRecvBufferPoolCapacity(void) { return mRecvBufferPool.GetCapacity(); }
+    inline uint32_t				GetRecvBufferUseCount(void) { return mRecvBufferPool.GetCapacity() - mRecvBufferPool.GetSize(); }
     inline uint32_t				GetMaxSessionCount(void) const { return mMaxSessionCount; }
+    uint32_t					GetSessionTableCapacity(void) const;	// ݱ   ü 
 
 public: //  ڵ鷯  Լ
 
@@ -98,8 +216,9 @@ public: // 
     virtual void OnAccept(const uint64_t sessionID) = 0;
 
     // ϼ Ŷ Ͽ  ȣ˴ϴ.
-    // ޵ Ŷ   ־ մϴ.
-    virtual void OnReceive(const uint64_t sessionID, Serializer* packet) = 0;
+    // ޵ Ŷ   ۸  Ű  Լ ϸ ȿ ˴ϴ.
+    // ٸ  ѱų ؾ Ѵٸ packet.Clone() ؼ ؾ մϴ.
+    virtual void OnReceive(const uint64_t sessionID, PacketView& packet) = 0;
 
     //    ȣ
     //  Լ ȣǸ  ̻ ش ID ȿ ʽϴ.
@@ -107,22 +226,119 @@ public: // 
 
 private: //  Լ
 
-    static unsigned int acceptThread(void* netServerParam);     // Accept,   
-    static unsigned int iocpWorkerThread(void* netServerParam); // IOCP ̺Ʈ ó
+    static unsigned int acceptThread(void* netServerParam);     // Accept,    (mAcceptThreadCount)
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+    static unsigned int iocpWorkerThread(void* netServerParam); // IOCP ̺Ʈ ó (GQCSEx Ƽ )
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+    static unsigned int epollWorkerThread(void* netServerParam);// epoll ̺Ʈ ó
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+    static unsigned int uringWorkerThread(void* netServerParam);// io_uring Ϸ  ó (Ŀ  ϳ)
+#endif
     static unsigned int monitorThread(void* netServerParam);    // ͸  
 
 private: //  ƿ Լ
 
-    //  ID   ü ´
+    //  ϵ  listen ·  ( Ͽ ӵ ɼǵ ⼭ )
+    void createListenSockets(void);
+
+    // accept    ù Recv Ǵ, ִ    ݰ false
+    bool acceptSession(const SOCKET clientSocket, const SOCKADDR_IN& clientAddress);
+
+    // mSocketTuningProfile  Ͽ Ѵ, bLogResult    α׷ 
+    void applySocketTuningProfile(const SOCKET listenSocket, const bool bLogResult);
+
+    //   IOCP/epoll/ ε
+    inline uint32_t getIoShardIndex(const uint32_t sessionListKey) const { return sessionListKey % mIoShardCount; }
+
+    //  ID   ü ´ (   Ű nullptr)
     Session* findSessionOrNull(const uint64_t sessionID) const;
 
+    //   Ű    ̺  ϳ ߰ϰ Ű ִ´, ִ   ߴٸ false
+    bool growSessionTable(void);
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+    //  SendSlab    blockIndex ĭ  ۷ Ѵ, ϳ ߴٸ  ǵ false
+    bool registerSendSlabBlock(const uint32_t blockIndex, char* sendSlabBlock);
+#endif
+
+    //   Ű ٷ  ʰ mSessionEpoch  Ⱓ ٸ Ѵ (   ȣ)
+    void retireSessionKey(const uint32_t sessionKey);
+
+    //  Ⱓ   Ű mUnusedSessionKeys ش, ϳ ٸ true (  Ű    忡 1ʸ ȣ)
+    bool reclaimSessionKeys(void);
+
+    //  Ŷ ֱ  SendQueue ѵ Ȯϰ ESendOverflowPolicy Ѵ, Ŷ ־ ȴٸ true
+    bool reserveSendQueue(Session* session, const Serializer* packet);
+
+    // Ŷ   ڿ ȣ - SendQueue ְ ۽ ɰų( ۽  FlushSends() Ͽ ְų) Ѵ
+    void enqueueSendPacket(Session* session, const uint64_t sessionID, Serializer* packet);
+
+    // RecvBuffer  ϼ Ŷ OnReceive() Ѵ, ߸ Ŷ ־ٸ false ( )
+    bool processReceivedPackets(Session* session);
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+    //  Send/Recv Ϸ  ϳ óϰ  IoCount ȯѴ
+    void processIocpCompletion(Session* session, OVERLAPPED* overlapped, const DWORD transferredBytes);
+#endif
+
+private: // ͸ īƮ
+
+    // ȣ  ͸ īƮ flushMonitoringCounts()  Ƶд (Ŀ    ȣ)
+    inline static void beginMonitoringBatch(void) { l_monitoringBatch.bIsBatching = true; }
+
+    // ͸ īƮ  - ġ      , ƴ϶ ٷ ݿѴ
+    inline void addMonitoringCount(const EMonitoringCounter counter, const uint32_t count = 1)
+    {
+        if (l_monitoringBatch.bIsBatching)
+        {
+            l_monitoringBatch.Counts[static_cast<int>(counter)] += count;
+            return;
+        }
+
+        InterlockedAdd(reinterpret_cast<LONG*>(getMonitoringVariable(counter)), count);
+    }
+
+    // Ƶ ͸ īƮ mMonitoringVariables ݿѴ (Ŀ 尡 ġ ȣ)
+    void flushMonitoringCounts(void);
+
+    uint32_t* getMonitoringVariable(const EMonitoringCounter counter);
+
 private:
 
     bool				    mbIsRunning;				//  
     bool				    mbIsTcpNodelay;				// ɼ - TCP_NODELAY ϴ°
     bool				    mbIsSendBufferSizeZero;		// ɼ - SND_BUF  0
-    HANDLE				    mIOCP;						// IOCP ڵ
-    SOCKET				    mListenSocket;				//  
+    bool				    mbIsIoSharded;				// ɼ - Ŀ 帶 IOCP/epoll  
+    bool				    mbIsSendDeferred;			// ɼ - SendPacket() ť ְ FlushSends() ۽
+    bool				    mbIsAcceptPaused;			// PauseAccept() - Accept 尡 accept()  ʴ´
+    LockFreeQueue<uint64_t> mSendDirtySessionIDs;       //  FlushSends()  SendPacket()   ID
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+    HANDLE*				    mIOCPs;						// IOCP ڵ
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+    int*                    mEpolls;                    // epoll fd
+    int                     mNotifyEvent;               // Ŀ 带  eventfd ( û, ) -  epoll 
+    LockFreeQueue<uint64_t> mReleaseQueue;              // OnRelease ȣ  ID (PQCS )
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+    IoUring*                mRings;                     // Ŀ 帶 ϳ ϴ 
+    LockFreeQueue<uint64_t> mReleaseQueue;              // OnRelease ȣ  ID (PQCS )
+#endif
+    uint32_t                mIoShardCount;              // IOCP/epoll/  (  : 1,   : Ŀ  )
+    uint32_t                mBoundIoShardCount;         // IOCP/epoll/  Ŀ  
+    SOCKET*				    mListenSockets;				//  ϵ (Linux : Accept 帶 ϳ, Windows : ϳ)
+    uint32_t			    mListenSocketCount;			//   
+    uint32_t			    mAcceptThreadCount;			// Accept  
+    uint32_t			    mBoundListenSocketCount;	//    Accept  
+    uint32_t			    mMaxSendBufferCount;		// ۽ 1ȸ  ִ  
+    uint32_t			    mSendCoalescingSize;		// ۽   Ŷ ִ ũ (0̸   )
+    uint32_t			    mMaxSendQueueCount;			// Ǻ SendQueue ִ Ŷ  (0̸  )
+    uint32_t			    mMaxSendQueueBytes;			// Ǻ SendQueue ִ Ʈ  (0̸  )
+    ESendOverflowPolicy     mSendOverflowPolicy;        // SendQueue ѵ ɷ  ó
+    uint32_t			    mMaxConnectionsPerIp;		// IP ִ    (0̸  )
+    uint32_t			    mMaxConnectsPerIpPerSecond;	// IP ʴ ִ  Ƚ (0̸  )
+    IpConnectionTable       mIpConnectionTable;         // IP   (IP    )
+    uint32_t			    mMaxRecvPacketsPerSecond;	// Ǻ ʴ ִ  Ŷ  (0̸  )
+    uint32_t			    mMaxRecvBytesPerSecond;		// Ǻ ʴ ִ  Ʈ  (0̸  )
+    SocketTuningProfile     mSocketTuningProfile;       // ɼ -  Ͽ  TCP Ʃ 
     uint16_t			    mPort;						// Ʈ ȣ
     uint16_t			    mMaxPayloadLength;			// ̷ε ִ  (Header.Length)
     uint32_t			    mMaxSessionCount;			//  ִ  
@@ -134,6 +350,35 @@ private:
     uint64_t			    mSessionDisconnectedCount;	//  ۵ ĺ ݱ   
     uint32_t			    mSessionCount;				//     
 
-    Session* mSessionList;                              //  Ʈ (Ǯ)
+    struct MonitoringBatch
+    {
+        bool        bIsBatching;
+        uint32_t    Counts[static_cast<int>(EMonitoringCounter::Count)];
+    };
+
+    inline static thread_local MonitoringBatch l_monitoringBatch{}; // Ŀ 尡 ġ  Ƶ ͸ īƮ
+
+    // RecvBuffer  ߸ Ŷ ̾ ̴  (ϼ Ŷ RecvBuffer Ŭ  , MirroredRingBuffer  )
+    inline static thread_local char l_wrappedPacketBuffer[RingBuffer::DEFAULT_SIZE];
+
+    Session**               mSessionBlocks;             //  ̺ - SESSION_BLOCK_SIZE   ϵ (   nullptr)
+    char**                  mSendSlabBlocks;            //  ϸ SendSlab     (۽ ġ⸦  ʰų    nullptr)
+    uint32_t                mSessionBlockCount;         //    (տ ä)
+    uint32_t                mMaxSessionBlockCount;      // ִ     ִ  
+    SRWLOCK                 mSessionTableLock;          //  ߰  (ȸ  )
     LockFreeStack<uint32_t>	mUnusedSessionKeys;         //    Ű
+
+    // SendPacket()   IoCount  mSessionEpoch б  ȿ  ID ȮѴ
+    //   Ű   б   尡      ʴ´
+    struct RetiredSessionKey
+    {
+        uint32_t    Key;
+        int64_t     Epoch;                              // EpochDomain::Retire()  ũ
+    };
+
+    mutable EpochDomain     mSessionEpoch;
+    LockFreeQueue<RetiredSessionKey> mRetiredSessionKeys;   //   Ű ( Ⱓ Ȯ )
+    std::deque<RetiredSessionKey> mGraceSessionKeys;    //  Ⱓ ٸ  Ű (mRetiredSessionKeyLock ʿ)
+    SRWLOCK                 mRetiredSessionKeyLock;     //  Ű ȸ 
+    LockFreeObjectPool<SessionRecvBuffer> mRecvBufferPool;  // ǵ     ( ޸𸮰 ִ   ƴ Ȱ    󰣴)
 };
\ No newline at end of file
@@ -3,10 +3,18 @@
 #pragma once
 #pragma comment(lib, "ws2_32")
 
+#ifdef _WIN32
 #include <WinSock2.h>
 #include <WS2tcpip.h>
 #include <Windows.h>
-
+#else
+#include "../Platform/LinuxCompat.h"
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/uio.h>
+#endif
+
+#include "IoEngine.h"
 #include "../Logger/Logger.h"
 
 ////////////////////////////////////////////////
@@ -91,9 +99,58 @@ public:
     // accept()
     inline static SOCKET    GetAcceptedSocketOrInvalid(const SOCKET listenSocket, SOCKADDR_IN* outAddress)
     {
+#ifdef _WIN32
         int clientAddressLength = sizeof(SOCKADDR_IN);
         return ::accept(listenSocket, (SOCKADDR*)outAddress, &clientAddressLength);
+#else
+        // epoll  ŷ   Ѵ
+        socklen_t clientAddressLength = sizeof(SOCKADDR_IN);
+        int clientSocket = ::accept4(static_cast<int>(listenSocket), (SOCKADDR*)outAddress, &clientAddressLength, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        return clientSocket == -1 ? INVALID_SOCKET : static_cast<SOCKET>(clientSocket);
+#endif
+    }
+
+    // WSAPoll(POLLIN) -  Ͽ accept     , ŸӾƿ̶ false
+    inline static bool      WaitForAcceptable(const SOCKET listenSocket, const int timeoutMs)
+    {
+        WSAPOLLFD pollFd{};
+        pollFd.fd = listenSocket;
+        pollFd.events = POLLIN;
+
+        int retPoll = ::WSAPoll(&pollFd, 1, timeoutMs);
+
+        return retPoll > 0;
+    }
+
+    // ŷ  accept()  (Linux closesocket()δ accept() ȯ )
+    inline static void      WakeUpAccept(const SOCKET listenSocket)
+    {
+#ifndef _WIN32
+        ::shutdown(static_cast<int>(listenSocket), SHUT_RDWR);
+#endif
+    }
+
+    // ioctlsocket(FIONBIO) - ŷ  ȯ
+    inline static void      SetNonBlocking(const SOCKET socket)
+    {
+        u_long mode = 1;
+
+        int retIoctl = ::ioctlsocket(socket, FIONBIO, &mode);
+
+        ASSERT_LIVE(retIoctl != SOCKET_ERROR, L"SetNonBlocking() failed");
+    }
+
+#ifndef _WIN32
+    // setsockopt(SO_REUSEPORT) -  Ʈ     Ŀ  ش
+    inline static void      SetReusePort(const SOCKET socket)
+    {
+        const int optionValue = 1;
+
+        int retSetsockopt = ::setsockopt(socket, SOL_SOCKET, SO_REUSEPORT, (const char*)&optionValue, sizeof(optionValue));
+
+        ASSERT_LIVE(retSetsockopt != SOCKET_ERROR, L"SetReusePort() failed");
     }
+#endif
 
     // setsockopt(SO_LINGER)
     inline static void      SetLinger(const SOCKET socket, const u_short onoff, const u_short linger)
@@ -125,8 +182,73 @@ public:
         ASSERT_LIVE(retSetsockopt != SOCKET_ERROR, L"SetTcpNodelay() failed");
     }
 
+    // setsockopt(SO_RCVBUF)
+    inline static void      SetReceiveBufferSize(const SOCKET socket, const int receiveBufferSize)
+    {
+        int retSetsockopt = ::setsockopt(socket, SOL_SOCKET, SO_RCVBUF, (const char*)&receiveBufferSize, sizeof(receiveBufferSize));
+
+        ASSERT_LIVE(retSetsockopt != SOCKET_ERROR, L"SetReceiveBufferSize() failed");
+    }
+
+    // getsockopt(SO_RCVBUF / SO_SNDBUF) -   ũ (Linux û ũ 2踦 ´)
+    inline static int       GetReceiveBufferSize(const SOCKET socket) { return getSocketOptionInt(socket, SOL_SOCKET, SO_RCVBUF); }
+    inline static int       GetSendBufferSize(const SOCKET socket) { return getSocketOptionInt(socket, SOL_SOCKET, SO_SNDBUF); }
+
+    // setsockopt(SO_KEEPALIVE, TCP_KEEPIDLE, TCP_KEEPINTVL, TCP_KEEPCNT) - intervalSec, probeCount 0̸ OS ⺻
+    //  ʴ ɼ ִٸ false (Windows 10 1703  TCP_KEEPCNT )
+    inline static bool      SetKeepAlive(const SOCKET socket, const int idleSec, const int intervalSec, const int probeCount)
+    {
+        const int optionValue = 1;
+
+        if (::setsockopt(socket, SOL_SOCKET, SO_KEEPALIVE, (const char*)&optionValue, sizeof(optionValue)) == SOCKET_ERROR)
+        {
+            return false;
+        }
+
+        if (::setsockopt(socket, IPPROTO_TCP, TCP_KEEPIDLE, (const char*)&idleSec, sizeof(idleSec)) == SOCKET_ERROR)
+        {
+            return false;
+        }
+
+        if (intervalSec > 0 && ::setsockopt(socket, IPPROTO_TCP, TCP_KEEPINTVL, (const char*)&intervalSec, sizeof(intervalSec)) == SOCKET_ERROR)
+        {
+            return false;
+        }
+
+        if (probeCount > 0 && ::setsockopt(socket, IPPROTO_TCP, TCP_KEEPCNT, (const char*)&probeCount, sizeof(probeCount)) == SOCKET_ERROR)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+#ifndef _WIN32
+    // setsockopt(TCP_QUICKACK) -  ACK  ( ʾƼ Ŀ Ȳ  ٽ  ACK ư  ִ)
+    inline static bool      SetQuickAck(const SOCKET socket)
+    {
+        const int optionValue = 1;
+
+        return ::setsockopt(socket, IPPROTO_TCP, TCP_QUICKACK, (const char*)&optionValue, sizeof(optionValue)) != SOCKET_ERROR;
+    }
+
+    // setsockopt(TCP_NOTSENT_LOWAT) -    Ͱ  ũ⺸     Ѵ
+    inline static bool      SetNotSentLowat(const SOCKET socket, const int bytes)
+    {
+        return ::setsockopt(socket, IPPROTO_TCP, TCP_NOTSENT_LOWAT, (const char*)&bytes, sizeof(bytes)) != SOCKET_ERROR;
+    }
+
+    // setsockopt(SO_BUSY_POLL) -  Ͱ   NIC ť ٻڰ Ȯ ð, net.core.busy_read ũٸ CAP_NET_ADMIN ʿϴ
+    inline static bool      SetBusyPoll(const SOCKET socket, const int microseconds)
+    {
+        return ::setsockopt(socket, SOL_SOCKET, SO_BUSY_POLL, (const char*)&microseconds, sizeof(microseconds)) != SOCKET_ERROR;
+    }
+#endif
+
 #pragma endregion
 
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+
 #pragma region IOCP 
 
     // CreateIOCP(-1, 0, 0, iocpConcurrentThreadCount)
@@ -147,6 +269,70 @@ public:
 
 #pragma endregion
 
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+
+#pragma region epoll 
+
+    // epoll_create1()
+    inline static int       CreateNewEpoll(void)
+    {
+        int epoll = ::epoll_create1(EPOLL_CLOEXEC);
+        ASSERT_LIVE(epoll != -1, L"CreateNewEpoll() failed");
+
+        return epoll;
+    }
+
+    // epoll_ctl(ADD) - edge-triggered, ̺Ʈ ͷ completionKey( ID) 
+    inline static void      RegisterEpoll(const SOCKET socket, const int epoll, const uint64_t completionKey)
+    {
+        epoll_event event{};
+        event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+        event.data.u64 = completionKey;
+
+        int retEpollCtl = ::epoll_ctl(epoll, EPOLL_CTL_ADD, static_cast<int>(socket), &event);
+        ASSERT_LIVE(retEpollCtl != -1, L"RegisterEpoll() failed");
+    }
+
+    // eventfd() - PostQueuedCompletionStatus() 
+    inline static int       CreateNotifyEvent(void)
+    {
+        int eventFd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        ASSERT_LIVE(eventFd != -1, L"CreateNotifyEvent() failed");
+
+        return eventFd;
+    }
+
+    // epoll_ctl(ADD) - eventfd level-triggered  ( epoll   ִ)
+    inline static void      RegisterNotifyEvent(const int eventFd, const int epoll, const uint64_t completionKey)
+    {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.u64 = completionKey;
+
+        int retEpollCtl = ::epoll_ctl(epoll, EPOLL_CTL_ADD, eventFd, &event);
+        ASSERT_LIVE(retEpollCtl != -1, L"RegisterNotifyEvent() failed");
+    }
+
+    // eventfd write()
+    inline static void      SignalNotifyEvent(const int eventFd)
+    {
+        uint64_t value = 1;
+        ssize_t retWrite = ::write(eventFd, &value, sizeof(value));
+        (void)retWrite; // EAGAIN̶ ̹ ȣ 
+    }
+
+    // eventfd read() - ȣ  
+    inline static void      ClearNotifyEvent(const int eventFd)
+    {
+        uint64_t value;
+        ssize_t retRead = ::read(eventFd, &value, sizeof(value));
+        (void)retRead;
+    }
+
+#pragma endregion
+
+#endif
+
 #pragma region ּ ȯ
 
     inline static std::wstring      GetIpAddress(const SOCKADDR_IN address)
@@ -178,4 +364,24 @@ public:
     }
 
 #pragma endregion
+
+private:
+
+    // getsockopt() - int ɼ , ж -1
+    inline static int               getSocketOptionInt(const SOCKET socket, const int level, const int optionName)
+    {
+        int optionValue = 0;
+#ifdef _WIN32
+        int optionLength = sizeof(optionValue);
+#else
+        socklen_t optionLength = sizeof(optionValue);
+#endif
+
+        if (::getsockopt(socket, level, optionName, (char*)&optionValue, &optionLength) == SOCKET_ERROR)
+        {
+            return -1;
+        }
+
+        return optionValue;
+    }
 };
\ No newline at end of file
@@ -4,8 +4,19 @@
 
 #define NETWORK_HEADER_TYPE_LAN 0 // LAN  : ̸ 
 #define NETWORK_HEADER_TYPE_NET 1 // NET  :  ڵ ߰  Ŷ ȣȭ/ȣȭ 
+#define NETWORK_HEADER_TYPE_NET_STREAM 2 // NET  + Ű Ʈ ȣȭ :  NET , Ḷ Ŭ̾Ʈ  ù Ŷ ڵ ȣȭ  Ѵ
 
+// ⺻ NET - Ű Ʈ ȣȭ   ɼ NETWORK_HEADER_USE_TYPE=2 (NET_STREAM) Ѵ
+#ifndef NETWORK_HEADER_USE_TYPE
 #define NETWORK_HEADER_USE_TYPE NETWORK_HEADER_TYPE_NET
+#endif
+
+// Ŷ ȣȭ  - LAN  ʰ, NET ׻ Chain
+enum class ENetworkCipher : uint8_t
+{
+    Chain,  //  Ʈ  ̾ ޴ XOR ü (NETWORK_HEADER_CODE) -  Ŭ̾Ʈ
+    Stream  // ġ  Ű Ʈ (NETWORK_HEADER_STREAM_CODE) - Ʈ   SIMD 16~32Ʈ óѴ
+};
 
 #if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_LAN
 
@@ -16,15 +27,16 @@ struct NetworkHeader
 
 static_assert(sizeof(NetworkHeader) == 2);
 
-#elif NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
+#elif NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET || NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET_STREAM
 
 #define NETWORK_HEADER_CODE 0x77      //  Ŷ ɷ   
+#define NETWORK_HEADER_STREAM_CODE 0x78 // Ű Ʈ ȣȭ Ŷ   (NET_STREAM ޴´)
 #define NETWORK_HEADER_FIXED_KEY 0x32 // ޽ ȣȭ   Ű
 
 #pragma pack (push,1)
 struct NetworkHeader
 {
-    uint8_t     Code;       // NETWORK_HEADER_CODE  
+    uint8_t     Code;       // NETWORK_HEADER_CODE   (Ű Ʈ ȣȭ NETWORK_HEADER_STREAM_CODE)
     uint16_t    Length;     // ̷ε  ( )
     uint8_t     RandKey;    // ޽ ȣȭ   Ű
     uint8_t     CheckSum;   // ȣȭ   Ǵ  üũ
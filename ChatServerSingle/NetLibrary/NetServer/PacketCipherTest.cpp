@@ -0,0 +1,260 @@
+////////////////////////////////////////////////
+// Ŷ ڵ/ڵ Ȯ - üũ ڵ ȸ ģ ڿ  ( ڵ   ջ)  
+// 1. getCheckSum() SSE2 ջ Ʈ  հ 
+// 2. ü ڵ(prepareSend)    ڵϸ  ̷ε ´ üũ  ( Ŭ̾Ʈ ȣȯ)
+// 3.   ڵ Ŷ(/Ʈ ϳ ٲ ) decode()/decodeChained()  İ  ϴ
+// 4. Ű Ʈ ڵ  ȯ(getSendPacket()) ģ Ŷ ٽ  ̷ε ƿ
+// Serializer ڵ/ڵ Լ NetServer ̹Ƿ -Dprivate=public Ѵ
+// Ʈ  ʴ ܵ  ,  Ȯ ִٸ 1 ȯѴ
+// Linux : g++ -std=c++17 -O2 -Dprivate=public -I../.. PacketCipherTest.cpp ../CrashDump/CrashDump.cpp ../Platform/LinuxCompat.cpp -o PacketCipherTest -lpthread
+////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <vector>
+
+#include "Serializer.h"
+
+static int g_failCount = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { wprintf(L"FAIL %hs:%d %hs\n", __FILE__, __LINE__, #Condition); g_failCount++; } } while (0)
+
+static uint32_t g_randomState = 0x1B87'3593;
+
+static uint32_t nextRandom(void)
+{
+    g_randomState ^= g_randomState << 13;
+    g_randomState ^= g_randomState >> 17;
+    g_randomState ^= g_randomState << 5;
+    return g_randomState;
+}
+
+static std::vector<char> makePayload(const uint32_t size)
+{
+    std::vector<char> payload(size);
+    for (char& value : payload)
+    {
+        value = static_cast<char>(nextRandom() >> 24);
+    }
+
+    return payload;
+}
+
+static uint8_t sumBytes(const unsigned char* data, const uint32_t size)
+{
+    uint8_t checkSum = 0;
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        checkSum += data[i];
+    }
+
+    return checkSum;
+}
+
+//   ü ڵ - üũ  ϰ üũ Ʈ  ٷ ȣȭѴ ( + üũ + ̷ε)
+static std::vector<unsigned char> encodeChainReference(const std::vector<char>& payload, const uint8_t randKey)
+{
+    const uint32_t payloadSize = static_cast<uint32_t>(payload.size());
+
+    std::vector<unsigned char> packet = { NETWORK_HEADER_CODE, static_cast<unsigned char>(payloadSize), static_cast<unsigned char>(payloadSize >> 8), randKey };
+    packet.push_back(sumBytes(reinterpret_cast<const unsigned char*>(payload.data()), payloadSize));
+    packet.insert(packet.end(), payload.begin(), payload.end());
+
+    unsigned char nextRandKey = 0;
+    unsigned char prevEncodedValue = 0;
+    for (uint32_t i = 0; i < payloadSize + 1; ++i)
+    {
+        unsigned char& value = packet[4 + i];
+        nextRandKey = value ^ static_cast<unsigned char>(nextRandKey + randKey + i + 1);
+        value = nextRandKey ^ static_cast<unsigned char>(prevEncodedValue + NETWORK_HEADER_FIXED_KEY + i + 1);
+        prevEncodedValue = value;
+    }
+
+    return packet;
+}
+
+//   ü ڵ -  ڵ ڿ ̷ε带  ջؼ üũ Ѵ
+static bool decodeChainReference(std::vector<unsigned char>& packet)
+{
+    const uint32_t payloadSize = packet[1] | (packet[2] << 8);
+    const unsigned char randKey = packet[3];
+
+    unsigned char prevRandKey = 0;
+    unsigned char prevEncodedValue = 0;
+    for (uint32_t i = 0; i < payloadSize + 1; ++i)
+    {
+        unsigned char& value = packet[4 + i];
+        unsigned char currentRandKey = value ^ static_cast<unsigned char>(prevEncodedValue + NETWORK_HEADER_FIXED_KEY + i + 1);
+        prevEncodedValue = value;
+        value = currentRandKey ^ static_cast<unsigned char>(prevRandKey + randKey + i + 1);
+        prevRandKey = currentRandKey;
+    }
+
+    return packet[4] == sumBytes(packet.data() + sizeof(NetworkHeader), payloadSize);
+}
+
+//  ̾   
+static std::vector<unsigned char> flatten(const Serializer* packet)
+{
+    std::vector<unsigned char> bytes;
+    packet->ForEachBuffer([&bytes](char* buffer, uint32_t length)
+        {
+            bytes.insert(bytes.end(), buffer, buffer + length);
+        });
+
+    return bytes;
+}
+
+// ڵ   ׸Ʈ ̾ Ŷ ű (getConvertedPacket()ó  ϰ ̷ε带 ִ´)
+static Serializer* makeChainedCopy(const std::vector<unsigned char>& encoded)
+{
+    const uint32_t payloadSize = static_cast<uint32_t>(encoded.size() - sizeof(NetworkHeader));
+
+    Serializer* packet = Serializer::Alloc(10);
+    memcpy(packet->GetFullBufferPointer(), encoded.data(), sizeof(NetworkHeader));
+    packet->InsertByte(reinterpret_cast<const char*>(encoded.data()) + sizeof(NetworkHeader), payloadSize);
+
+    return packet;
+}
+
+static bool matchPayload(const Serializer* packet, const std::vector<char>& payload)
+{
+    std::vector<unsigned char> bytes = flatten(packet);
+    return bytes.size() == sizeof(NetworkHeader) + payload.size()
+        && memcmp(payload.data(), bytes.data() + sizeof(NetworkHeader), payload.size()) == 0;
+}
+
+// SSE2 16Ʈ   Ʈ  հ  (ĵ   ġ )
+static void testCheckSumParity(void)
+{
+    std::vector<char> buffer = makePayload(70'000);
+
+    for (uint32_t round = 0; round < 5'000; ++round)
+    {
+        const uint32_t offset = nextRandom() % 64;
+        const uint32_t size = round < 100 ? round : nextRandom() % 65'536;
+
+        CHECK(Serializer::getCheckSum(buffer.data() + offset, size) == sumBytes(reinterpret_cast<unsigned char*>(buffer.data()) + offset, size));
+    }
+}
+
+// ü ڵ    ڵ  ־ Ѵ (׸Ʈ ̾ Ŷ )
+static void testChainEncodeCompatibility(void)
+{
+    const uint32_t sizes[] = { 0, 1, 15, 16, 17, 63, 64, 65, 1'000, 1'025, 5'000, 8'193, 30'000, Serializer::MAX_PAYLOAD_SIZE };
+
+    for (uint32_t size : sizes)
+    {
+        std::vector<char> payload = makePayload(size);
+
+        Serializer* packet = Serializer::Alloc(size);
+        packet->InsertByte(payload.data(), size);
+        packet->prepareSend(ENetworkCipher::Chain);
+
+        std::vector<unsigned char> encoded = flatten(packet);
+        CHECK(encoded[0] == NETWORK_HEADER_CODE);
+        CHECK(decodeChainReference(encoded));
+        CHECK(memcmp(payload.data(), encoded.data() + sizeof(NetworkHeader), payload.size()) == 0);
+
+        Serializer::Free(packet);
+    }
+}
+
+// üũ ģ decode()/decodeChained()   İ  -  Ŷ Ʈ ϳ ٲ Ŷ
+static void testFusedDecodeParity(void)
+{
+    uint32_t rejectedCount = 0;
+
+    for (uint32_t round = 0; round < 3'000; ++round)
+    {
+        const uint32_t size = round < 300 ? round : nextRandom() % 20'000;
+        const uint8_t randKey = static_cast<uint8_t>(nextRandom());
+        std::vector<char> payload = makePayload(size);
+
+        std::vector<unsigned char> encoded = encodeChainReference(payload, randKey);
+
+        //  üũ Ʈ    Ʈ ٲ۴
+        if (round % 2 == 1)
+        {
+            const uint32_t corruptIndex = 4 + nextRandom() % (size + 1);
+            encoded[corruptIndex] ^= static_cast<unsigned char>(1 + nextRandom() % 255);
+        }
+
+        std::vector<unsigned char> reference = encoded;
+        const bool bIsReferenceValid = decodeChainReference(reference);
+
+        //  ۸ ڸ ڵϴ 
+        std::vector<unsigned char> contiguous = encoded;
+        const bool bIsValid = Serializer::decode(reinterpret_cast<char*>(contiguous.data()));
+        CHECK(bIsValid == bIsReferenceValid);
+        CHECK(contiguous == reference);
+
+        // ׸Ʈ ̾ Ŷ ڵϴ 
+        Serializer* chained = makeChainedCopy(encoded);
+        const bool bIsChainedValid = chained->decodeChained();
+        CHECK(bIsChainedValid == bIsReferenceValid);
+        CHECK(flatten(chained) == reference);
+        Serializer::Free(chained);
+
+        if (false == bIsReferenceValid)
+        {
+            rejectedCount++;
+        }
+    }
+
+    // ٲ Ŷ κ üũ ɷ
+    CHECK(rejectedCount > 1'400);
+}
+
+// Ű Ʈ ڵ  ȯ -   ޾Ƶ  ̷ε尡 ; Ѵ
+static void testStreamAndConversion(void)
+{
+    const uint32_t sizes[] = { 0, 1, 255, 256, 257, 1'000, 5'000, 20'000, Serializer::MAX_PAYLOAD_SIZE };
+
+    for (uint32_t size : sizes)
+    {
+        for (ENetworkCipher firstCipher : { ENetworkCipher::Chain, ENetworkCipher::Stream })
+        {
+            const ENetworkCipher secondCipher = firstCipher == ENetworkCipher::Chain ? ENetworkCipher::Stream : ENetworkCipher::Chain;
+            std::vector<char> payload = makePayload(size);
+
+            Serializer* packet = Serializer::Alloc(size);
+            packet->InsertByte(payload.data(), size);
+
+            CHECK(packet->getSendPacket(firstCipher) == packet);
+            Serializer* converted = packet->getSendPacket(secondCipher);
+            CHECK(converted != packet);
+            CHECK(packet->getSendPacket(secondCipher) == converted);
+
+            //  Ŷ  ؼ ڵѴ ( ۽   ó ״ д)
+            for (Serializer* sent : { packet, converted })
+            {
+                std::vector<unsigned char> encoded = flatten(sent);
+
+                Serializer* chained = makeChainedCopy(encoded);
+                CHECK(chained->decodeChained());
+                CHECK(matchPayload(chained, payload));
+                Serializer::Free(chained);
+
+                //  ó   ڵ
+                CHECK(Serializer::decode(reinterpret_cast<char*>(encoded.data())));
+                CHECK(memcmp(payload.data(), encoded.data() + sizeof(NetworkHeader), payload.size()) == 0);
+            }
+
+            Serializer::Free(packet);
+        }
+    }
+}
+
+int main(void)
+{
+    testCheckSumParity();
+    testChainEncodeCompatibility();
+    testFusedDecodeParity();
+    testStreamAndConversion();
+
+    wprintf(L"PacketCipherTest : %ls\n", g_failCount == 0 ? L"OK" : L"FAILED");
+    return g_failCount == 0 ? 0 : 1;
+}
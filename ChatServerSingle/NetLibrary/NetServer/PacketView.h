@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../CrashDump/CrashDump.h"
+#include "Serializer.h"
+
+////////////////////////////////////////////////
+//    Ŷ ϳ   д Ŭ
+// OnReceive()  Ŀ Ű ޸𸮰 ǹǷ,
+// Ŷ ٸ  ѱų ؾ Ѵٸ Clone() ؼ Ѵ
+////////////////////////////////////////////////
+class PacketView
+{
+public:
+    inline PacketView(const char* payload, const uint32_t size)
+        : mBuffer(payload)
+        , mSize(size)
+    {
+    }
+
+    PacketView(const PacketView& other) = delete;
+    PacketView& operator=(const PacketView& other) = delete;
+
+    inline uint32_t    GetUseSize(void) const { return mSize; }
+    inline uint32_t    GetRemainSize(void) const { return mSize - mDeserialingSize; }
+
+    // ̷ε   (  )
+    inline const char* GetUserBufferPointer(void) const { return mBuffer; }
+
+    //  ġ ޸𸮸 ״ ؿ (DeserialingSize þ)
+    inline bool GetByte(char* dest, const uint32_t size)
+    {
+        if (mDeserialingSize + size > mSize)
+        {
+            return false;
+        }
+
+        memcpy(dest, mBuffer + mDeserialingSize, size);
+        mDeserialingSize += size;
+
+        return true;
+    }
+
+    // ⺻ Ÿ ȭ -  ۴   Ƿ memcpy д´
+    template <typename T>
+    inline PacketView& operator>>(T& value)
+    {
+        static_assert(std::is_arithmetic<T>::value, "PacketView can deserialize only arithmetic types");
+
+        CrashDump::Assert(mDeserialingSize + sizeof(T) <= mSize);
+
+        memcpy(&value, mBuffer + mDeserialingSize, sizeof(T));
+        mDeserialingSize += sizeof(T);
+
+        return *this;
+    }
+
+    // ̷ε ü  ȭ ۿ Ѵ ( īƮ 1,   Serializer::Free() ʿ)
+    // ̷ε ̿ ´ ũ ޿ Ƿ  ù ۿ   (Ѵ κ ׸Ʈ  ´)
+    inline Serializer* Clone(void) const
+    {
+        Serializer* packet = Serializer::Alloc(mSize);
+
+        bool retInsert = packet->InsertByte(mBuffer, mSize);
+        CrashDump::Assert(retInsert);
+
+        return packet;
+    }
+
+private:
+    const char* mBuffer;
+    uint32_t    mSize;
+    uint32_t    mDeserialingSize = 0;
+};
@@ -9,7 +9,7 @@ public:
 
     RingBuffer() : mCapacity(DEFAULT_SIZE) { mBuffer = new char[DEFAULT_SIZE]; }
     RingBuffer(int bufferSize) : mCapacity(bufferSize) { mBuffer = new char[bufferSize]; }
-    ~RingBuffer() { delete mBuffer; }
+    ~RingBuffer() { delete[] mBuffer; }
 
     inline void  ClearBuffer(void) { mFront = mRear = 0; }
 
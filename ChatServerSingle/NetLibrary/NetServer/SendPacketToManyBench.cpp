@@ -0,0 +1,238 @@
+////////////////////////////////////////////////
+// Ҿƿ   -  Ŷ RECIPIENTS ǿ   SendPacket() ݺ SendPacketToMany()   Ѵ
+//  50 / 500 / 5000    ȣϸ鼭, ȣ  CPU ð  (Ŀ  ۽ ó  ʴ´)
+//  ۽̶ ȣ SendQueue ֱ⸸ ϰ,  ۿ FlushSends() ȣѴ
+// ٷ ۽̶ ȣ 尡 Ǹ ۽ ɱ  ý   κ̴ -   ̴  ۽ſ 
+//  ̿ Ŀ и ۽   ֵ   ؼ 
+// Ŭ̾Ʈ fork() ڽ μ -  5000 ΰ ޱ⸸ Ѵ
+// Ʈ  ʴ ܵ  , Linux 
+//
+//  (io_uring -DIO_ENGINE_USE_TYPE=2 ߰)
+//   g++ -std=c++17 -O2 -I../.. SendPacketToManyBench.cpp NetServer.cpp Session.cpp IoUring.cpp MirroredRingBuffer.cpp IpConnectionTable.cpp
+//       ../Platform/LinuxCompat.cpp ../Logger/Logger.cpp ../CrashDump/CrashDump.cpp ../Profiler/Profiler.cpp -o SendPacketToManyBench -lpthread
+// 
+//   ./SendPacketToManyBench PORT DEFERRED(0/1) [SENDS_PER_CASE=200000]
+////////////////////////////////////////////////
+
+#include <csignal>
+#include <ctime>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+#include "NetServer.h"
+#include "PacketView.h"
+
+namespace
+{
+    constexpr uint32_t MAX_RECIPIENT_COUNT = 5'000;
+    constexpr uint32_t CHAT_PAYLOAD_SIZE = 60;
+
+    ////////////////////////////////////////////////
+    //   ID Ƶδ 
+    ////////////////////////////////////////////////
+    class FanOutServer : public NetServer
+    {
+    public:
+        std::vector<uint64_t> GetSessionIDs(void)
+        {
+            std::lock_guard<std::mutex> lock(mSessionLock);
+            return mSessionIDs;
+        }
+
+    private:
+        void OnAccept(const uint64_t sessionID) override
+        {
+            std::lock_guard<std::mutex> lock(mSessionLock);
+            mSessionIDs.push_back(sessionID);
+        }
+
+        void OnReceive(const uint64_t sessionID, PacketView& packet) override
+        {
+            (void)sessionID;
+            (void)packet;
+        }
+
+        void OnRelease(const uint64_t sessionID) override
+        {
+            (void)sessionID;
+        }
+
+        std::mutex mSessionLock;
+        std::vector<uint64_t> mSessionIDs;
+    };
+
+    // ȣ 尡  CPU ð (ns)
+    uint64_t getThreadCpuTime(void)
+    {
+        timespec time;
+        ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time);
+        return static_cast<uint64_t>(time.tv_sec) * 1'000'000'000 + static_cast<uint64_t>(time.tv_nsec);
+    }
+
+    // ڽ μ - sessionCount ؼ  ñ׳    ޱ⸸ Ѵ
+    int runClient(const uint16_t port, const uint32_t sessionCount)
+    {
+        int epollHandle = ::epoll_create1(0);
+        std::vector<int> sockets;
+
+        sockaddr_in serverAddress{};
+        serverAddress.sin_family = AF_INET;
+        serverAddress.sin_port = htons(port);
+        serverAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        for (uint32_t i = 0; i < sessionCount; ++i)
+        {
+            int sock = ::socket(AF_INET, SOCK_STREAM, 0);
+
+            //   ϱ ̶  ٷȴٰ ٽ õѴ
+            int retryCount = 0;
+            while (::connect(sock, reinterpret_cast<sockaddr*>(&serverAddress), sizeof(serverAddress)) != 0)
+            {
+                if (++retryCount > 100)
+                {
+                    perror("connect");
+                    return 1;
+                }
+
+                ::close(sock);
+                sock = ::socket(AF_INET, SOCK_STREAM, 0);
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            }
+
+            ::fcntl(sock, F_SETFL, O_NONBLOCK);
+
+            epoll_event event{};
+            event.events = EPOLLIN;
+            event.data.u32 = i;
+            ::epoll_ctl(epollHandle, EPOLL_CTL_ADD, sock, &event);
+
+            sockets.push_back(sock);
+        }
+
+        static char recvBuffer[65536];
+        epoll_event events[512];
+
+        while (true)
+        {
+            int eventCount = ::epoll_wait(epollHandle, events, 512, 100);
+            for (int i = 0; i < eventCount; ++i)
+            {
+                while (::recv(sockets[events[i].data.u32], recvBuffer, sizeof(recvBuffer), 0) > 0)
+                {
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    // recipientCount  带 sendsPerCase / recipientCount,     -     CPU ð (ns)
+    void measureFanOut(FanOutServer& server, const std::vector<uint64_t>& sessionIDs, const uint32_t recipientCount, const uint32_t sendsPerCase, const bool bIsDeferred)
+    {
+        std::vector<char> payload(CHAT_PAYLOAD_SIZE, 0x2A);
+        const uint32_t roundCount = sendsPerCase / recipientCount < 20 ? 20 : sendsPerCase / recipientCount;
+
+        uint64_t loopTimeSum = 0;
+        uint64_t manyTimeSum = 0;
+
+        for (uint32_t round = 0; round < roundCount * 2; ++round)
+        {
+            //   帶 ű -  ǿ  ʵ
+            const uint64_t* recipients = sessionIDs.data() + (round * 37u) % (MAX_RECIPIENT_COUNT - recipientCount + 1);
+
+            Serializer* packet = Serializer::Alloc(CHAT_PAYLOAD_SIZE);
+            packet->InsertByte(payload.data(), CHAT_PAYLOAD_SIZE);
+
+            uint64_t startTime = getThreadCpuTime();
+
+            if (round % 2 == 0)
+            {
+                for (uint32_t i = 0; i < recipientCount; ++i)
+                {
+                    server.SendPacket(recipients[i], packet);
+                }
+
+                loopTimeSum += getThreadCpuTime() - startTime;
+            }
+            else
+            {
+                server.SendPacketToMany(recipients, recipientCount, packet);
+
+                manyTimeSum += getThreadCpuTime() - startTime;
+            }
+
+            Serializer::Free(packet);
+
+            if (bIsDeferred)
+            {
+                server.FlushSends();
+            }
+
+            std::this_thread::sleep_for(std::chrono::microseconds(recipientCount * 2));
+        }
+
+        const double recipientSendCount = static_cast<double>(roundCount) * recipientCount;
+        const double loopNs = loopTimeSum / recipientSendCount;
+        const double manyNs = manyTimeSum / recipientSendCount;
+
+        wprintf(L"RESULT %ls recipients %5u rounds %5u : SendPacket loop %7.1f ns/recipient (%8.1f us/call)  SendPacketToMany %7.1f ns/recipient (%8.1f us/call)  %+.1f%%\n",
+            bIsDeferred ? L"deferred" : L"immediate", recipientCount, roundCount,
+            loopNs, loopNs * recipientCount / 1'000, manyNs, manyNs * recipientCount / 1'000, (manyNs - loopNs) / loopNs * 100);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        wprintf(L"usage: %hs PORT DEFERRED(0/1) [SENDS_PER_CASE=200000]\n", argv[0]);
+        return 1;
+    }
+
+    const uint16_t port = static_cast<uint16_t>(atoi(argv[1]));
+    const bool bIsDeferred = atoi(argv[2]) != 0;
+    const uint32_t sendsPerCase = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 200'000;
+
+    //  Ŭ̾Ʈ   ŭ  
+    rlimit fileLimit;
+    ::getrlimit(RLIMIT_NOFILE, &fileLimit);
+    fileLimit.rlim_cur = fileLimit.rlim_max;
+    ::setrlimit(RLIMIT_NOFILE, &fileLimit);
+
+    //  尡   Ŭ̾Ʈ 
+    pid_t clientPid = ::fork();
+    if (clientPid == 0)
+    {
+        return runClient(port, MAX_RECIPIENT_COUNT);
+    }
+
+    FanOutServer server;
+    server.SetTcpNodelay(true);
+    server.SetDeferredSend(bIsDeferred);
+    server.Start(port, MAX_RECIPIENT_COUNT + 100, 2, 2);
+
+    // Ŭ̾Ʈ     ٸ
+    while (server.GetSessionCount() < MAX_RECIPIENT_COUNT)
+    {
+        ::Sleep(100);
+    }
+
+    std::vector<uint64_t> sessionIDs = server.GetSessionIDs();
+
+    for (uint32_t recipientCount : { 50u, 500u, 5'000u })
+    {
+        measureFanOut(server, sessionIDs, recipientCount, sendsPerCase, bIsDeferred);
+    }
+
+    ::kill(clientPid, SIGTERM);
+    ::waitpid(clientPid, nullptr, 0);
+
+    server.Shutdown();
+
+    return 0;
+}
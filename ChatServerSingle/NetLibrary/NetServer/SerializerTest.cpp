@@ -0,0 +1,316 @@
+////////////////////////////////////////////////
+// Serializer ׸Ʈ ü Ȯ - ù ۿ ׸Ʈ 踦 Ѵ /б(insertChained, copyOut) ۽ (ForEachBuffer)
+// ũ ޸  ٷ // ũ ִ ̷ε,  ũ   д´
+// Ʈ  ʴ ܵ  ,  Ȯ ִٸ 1 ȯѴ
+// Linux : g++ -std=c++17 -O2 -I../.. SerializerTest.cpp ../CrashDump/CrashDump.cpp ../Platform/LinuxCompat.cpp -o SerializerTest -lpthread
+////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cwchar>
+#include <vector>
+
+#include "Serializer.h"
+
+static int g_failCount = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { wprintf(L"FAIL %hs:%d %hs\n", __FILE__, __LINE__, #Condition); g_failCount++; } } while (0)
+
+static uint32_t g_randomState = 0x2545'F491;
+
+static uint32_t nextRandom(const uint32_t range)
+{
+    g_randomState ^= g_randomState << 13;
+    g_randomState ^= g_randomState >> 17;
+    g_randomState ^= g_randomState << 5;
+    return g_randomState % range + 1;
+}
+
+// ġ ٸ  -  ߳  ٷ 巯
+static char patternByte(const uint32_t position)
+{
+    return static_cast<char>((position * 167u + 13u) ^ (position >> 9));
+}
+
+static bool matchPattern(const char* buffer, const uint32_t size, const uint32_t startPosition)
+{
+    for (uint32_t i = 0; i < size; ++i)
+    {
+        if (buffer[i] != patternByte(startPosition + i))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// ù ۸  ̷ε尡 ϴ  
+static uint32_t expectedBufferCount(const uint32_t payloadSize, const uint32_t bufferSize)
+{
+    if (payloadSize <= bufferSize)
+    {
+        return 1;
+    }
+
+    return 1 + (payloadSize - bufferSize + Serializer::SEGMENT_SIZE - 1) / Serializer::SEGMENT_SIZE;
+}
+
+//   ũ  ִ´
+static bool insertPattern(Serializer* packet, const uint32_t size, const uint32_t maxChunkSize)
+{
+    std::vector<char> chunk(maxChunkSize);
+    uint32_t position = packet->GetUseSize();
+    const uint32_t endPosition = position + size;
+
+    while (position < endPosition)
+    {
+        uint32_t chunkSize = nextRandom(maxChunkSize);
+        if (chunkSize > endPosition - position)
+        {
+            chunkSize = endPosition - position;
+        }
+
+        for (uint32_t i = 0; i < chunkSize; ++i)
+        {
+            chunk[i] = patternByte(position + i);
+        }
+
+        if (false == packet->InsertByte(chunk.data(), chunkSize))
+        {
+            return false;
+        }
+
+        position += chunkSize;
+    }
+
+    return true;
+}
+
+// ForEachBuffer()  - ù  ,      ְ,  ̷ε ü
+static void checkSendBuffers(const Serializer* packet)
+{
+    const uint32_t payloadSize = packet->GetUseSize();
+    const uint32_t bufferSize = packet->GetBufferSize();
+
+    uint32_t bufferCount = 0;
+    uint32_t totalLength = 0;
+    uint32_t payloadPosition = 0;
+    bool bIsMatched = true;
+    bool bIsFullExceptLast = true;
+
+    packet->ForEachBuffer([&](char* buffer, uint32_t length)
+        {
+            if (bufferCount == 0)
+            {
+                if (buffer != packet->GetFullBufferPointer())
+                {
+                    bIsMatched = false;
+                }
+
+                buffer += sizeof(NetworkHeader);
+                length -= static_cast<uint32_t>(sizeof(NetworkHeader));
+                totalLength += static_cast<uint32_t>(sizeof(NetworkHeader));
+            }
+
+            //    áµ ڿ   Դ
+            if (bufferCount > 0 && payloadPosition != bufferSize + (bufferCount - 1) * Serializer::SEGMENT_SIZE)
+            {
+                bIsFullExceptLast = false;
+            }
+
+            if (false == matchPattern(buffer, length, payloadPosition))
+            {
+                bIsMatched = false;
+            }
+
+            payloadPosition += length;
+            totalLength += length;
+            bufferCount++;
+        });
+
+    CHECK(bIsMatched);
+    CHECK(bIsFullExceptLast);
+    CHECK(payloadPosition == payloadSize);
+    CHECK(totalLength == packet->GetFullSize());
+    CHECK(bufferCount == packet->GetBufferCount());
+    CHECK(bufferCount == expectedBufferCount(payloadSize, bufferSize));
+}
+
+//  ũ  д´ ( Ѵ б ؾ Ѵ)
+static void checkReadBack(Serializer* packet)
+{
+    const uint32_t payloadSize = packet->GetUseSize();
+    std::vector<char> chunk(Serializer::SEGMENT_SIZE * 2);
+    uint32_t position = 0;
+    bool bIsMatched = true;
+
+    while (position < payloadSize)
+    {
+        uint32_t chunkSize = nextRandom(static_cast<uint32_t>(chunk.size()));
+        if (chunkSize > payloadSize - position)
+        {
+            chunkSize = payloadSize - position;
+        }
+
+        CHECK(packet->GetByte(chunk.data(), chunkSize));
+
+        if (false == matchPattern(chunk.data(), chunkSize, position))
+        {
+            bIsMatched = false;
+        }
+
+        position += chunkSize;
+    }
+
+    CHECK(bIsMatched);
+    CHECK(false == packet->GetByte(chunk.data(), 1));
+}
+
+// ũ ޸  ó ũ  д´
+static void testChainAcrossBoundaries(void)
+{
+    const uint32_t sizeHints[] = { 10, 200, Serializer::DEFAULT_SIZE, 5'000 };
+
+    for (uint32_t sizeHint : sizeHints)
+    {
+        Serializer* probe = Serializer::Alloc(sizeHint);
+        const uint32_t bufferSize = probe->GetBufferSize();
+        Serializer::Free(probe);
+
+        const uint32_t payloadSizes[] = {
+            0, 1, bufferSize - 1, bufferSize, bufferSize + 1,
+            bufferSize + Serializer::SEGMENT_SIZE - 1, bufferSize + Serializer::SEGMENT_SIZE, bufferSize + Serializer::SEGMENT_SIZE + 1,
+            bufferSize + Serializer::SEGMENT_SIZE * 3 + 17, Serializer::MAX_PAYLOAD_SIZE };
+
+        for (uint32_t payloadSize : payloadSizes)
+        {
+            //   ֱ, ߰  ֱ, ׸Ʈ ũ  ֱ
+            for (uint32_t maxChunkSize : { payloadSize + 1, 7u, 700u, 9'000u })
+            {
+                Serializer* packet = Serializer::Alloc(sizeHint);
+
+                CHECK(packet->GetBufferSize() == bufferSize);
+                CHECK(insertPattern(packet, payloadSize, maxChunkSize));
+                CHECK(packet->GetUseSize() == payloadSize);
+                CHECK(packet->GetCapacity() >= payloadSize);
+
+                checkSendBuffers(packet);
+                checkReadBack(packet);
+
+                Serializer::Free(packet);
+            }
+        }
+    }
+}
+
+//  ϳ ù ۿ ׸Ʈ, ׸Ʈ ׸Ʈ ̿ ļ  
+static void testValuesAcrossBoundaries(void)
+{
+    Serializer* packet = Serializer::Alloc(10);
+    const uint32_t bufferSize = packet->GetBufferSize();
+
+    const uint64_t firstValue = 0x0102'0304'0506'0708;
+    const double secondValue = 3.141592653589793;
+    const uint32_t thirdValue = 0xCAFE'BABE;
+
+    // ù   3Ʈ տ 8Ʈ  
+    CHECK(insertPattern(packet, bufferSize - 3, 64));
+    *packet << static_cast<unsigned long long>(firstValue);
+    CHECK(packet->GetBufferCount() == 2);
+
+    // ù ׸Ʈ  5Ʈ տ 8Ʈ  4Ʈ  
+    std::vector<char> padding(Serializer::SEGMENT_SIZE - 5 - 5, 0x11);
+    CHECK(packet->InsertByte(padding.data(), static_cast<uint32_t>(padding.size())));
+    *packet << secondValue << static_cast<unsigned int>(thirdValue);
+    CHECK(packet->GetBufferCount() == 3);
+    CHECK(packet->GetUseSize() == bufferSize - 3 + 8 + static_cast<uint32_t>(padding.size()) + 8 + 4);
+
+    std::vector<char> skipBuffer(bufferSize);
+    unsigned long long readFirst = 0;
+    double readSecond = 0;
+    unsigned int readThird = 0;
+
+    CHECK(packet->GetByte(skipBuffer.data(), bufferSize - 3));
+    CHECK(matchPattern(skipBuffer.data(), bufferSize - 3, 0));
+    *packet >> readFirst;
+
+    std::vector<char> readPadding(padding.size());
+    CHECK(packet->GetByte(readPadding.data(), static_cast<uint32_t>(readPadding.size())));
+    *packet >> readSecond >> readThird;
+
+    CHECK(readFirst == firstValue);
+    CHECK(readPadding == padding);
+    CHECK(readSecond == secondValue);
+    CHECK(readThird == thirdValue);
+
+    Serializer::Free(packet);
+}
+
+// ִ ̷ε带 Ѵ  ϰ ƹ͵ ٲ ʴ´, Clear() ڿ ù ۸ ´
+static void testLimitAndClear(void)
+{
+    Serializer* packet = Serializer::Alloc(10);
+    const uint32_t bufferSize = packet->GetBufferSize();
+
+    std::vector<char> tooLarge(Serializer::MAX_PAYLOAD_SIZE + 1);
+    CHECK(false == packet->InsertByte(tooLarge.data(), static_cast<uint32_t>(tooLarge.size())));
+    CHECK(packet->GetUseSize() == 0);
+    CHECK(packet->GetBufferCount() == 1);
+
+    CHECK(insertPattern(packet, Serializer::MAX_PAYLOAD_SIZE, 1'500));
+    CHECK(packet->GetFreeSize() == 0);
+    CHECK(false == packet->InsertByte(tooLarge.data(), 1));
+    CHECK(packet->GetUseSize() == Serializer::MAX_PAYLOAD_SIZE);
+    CHECK(packet->GetBufferCount() <= Serializer::MAX_BUFFER_COUNT);
+    checkSendBuffers(packet);
+
+    packet->Clear();
+    CHECK(packet->GetUseSize() == 0);
+    CHECK(packet->GetBufferCount() == 1);
+    CHECK(packet->GetCapacity() == bufferSize);
+
+    //  ڿ ٽ ̾ ٿ ó 
+    CHECK(insertPattern(packet, bufferSize + Serializer::SEGMENT_SIZE + 1, 333));
+    checkSendBuffers(packet);
+    checkReadBack(packet);
+
+    Serializer::Free(packet);
+}
+
+// ̾  Ŷ ٸ Ŷ   ű (GetByte(Serializer*))
+static void testMoveToSerializer(void)
+{
+    Serializer* source = Serializer::Alloc(Serializer::DEFAULT_SIZE);
+    CHECK(insertPattern(source, 20'000, 2'000));
+
+    //  κ о ǳʶٰ, ׸Ʈ ߰ ϴ κ ű
+    std::vector<char> skipBuffer(1'500);
+    CHECK(source->GetByte(skipBuffer.data(), 1'500));
+
+    Serializer* dest = Serializer::Alloc(10);
+    CHECK(source->GetByte(dest, 12'345));
+    CHECK(dest->GetUseSize() == 12'345);
+    CHECK(dest->GetBufferCount() == expectedBufferCount(12'345, dest->GetBufferSize()));
+
+    std::vector<char> moved(12'345);
+    CHECK(dest->GetByte(moved.data(), 12'345));
+    CHECK(matchPattern(moved.data(), 12'345, 1'500));
+
+    //  ͺ  ű  
+    CHECK(false == source->GetByte(dest, 20'000 - 1'500 - 12'345 + 1));
+
+    Serializer::Free(dest);
+    Serializer::Free(source);
+}
+
+int main(void)
+{
+    testChainAcrossBoundaries();
+    testValuesAcrossBoundaries();
+    testLimitAndClear();
+    testMoveToSerializer();
+
+    wprintf(L"SerializerTest : %ls\n", g_failCount == 0 ? L"OK" : L"FAILED");
+    return g_failCount == 0 ? 0 : 1;
+}
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "NetUtils.h"
 
 #include "Session.h"
@@ -9,37 +11,49 @@
 
 void Session::Init(const SOCKET sock, const SOCKADDR_IN address, NetServer* netServer, const uint64_t sessionID, const uint32_t sessionListKey)
 {
-    //  ÷׸ Ѵ - ش  IoCount ٸ ǿ ǵ帱  ֱ⿡ Interlocked ʿ
-    InterlockedAnd(reinterpret_cast<LONG*>(&IoCount), 0x7FFF'FFFF);
-
     ID = sessionID;
     Socket = sock;
     Address = address;
     Server = netServer;
 
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
     ::memset(&SendOverlapped, 0, sizeof(OVERLAPPED));
     ::memset(&RecvOverlapped, 0, sizeof(OVERLAPPED));
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+    RecvEventCount = 0;
+    SendEventCount = 0;
+    SentBytes = 0;
+    bRecvClosed = false;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+    SentBytes = 0;
+#endif
 
     bSendFlag = 0;
+    bSendDirty = 0;
     SessionListKey = sessionListKey;
     bDisconnected = false;
     bDisconnectRegistered = false;
+    bDisconnectAfterSend = false;
+    bIpTracked = false;
 
-    RecvBuffer.ClearBuffer();
+    //  ū 1 з ä · Ѵ
+    RecvTokenTick = ::timeGetTime();
+    RecvPacketTokens = static_cast<uint64_t>(Server->mMaxRecvPacketsPerSecond) * 1'000;
+    RecvByteTokens = static_cast<uint64_t>(Server->mMaxRecvBytesPerSecond) * 1'000;
 
-    while (!SendQueue.IsEmpty())
-    {
-        Serializer* packet;
-        SendQueue.TryDequeue(packet);
-        packet->DecrementRefCount();
-    }
+    // ù Ŷ ޱ   Ŭ̾Ʈ  
+    Cipher.store(ENetworkCipher::Chain, std::memory_order_release);
+    RecvHeaderCode = 0;
 
-    for (uint32_t i = 0; i < RegisteredPacketCount; ++i)
-    {
-        RegisteredPackets[i]->DecrementRefCount();
-    }
+    // κ   Ǿ, ⼭    Ȯ SendPacket() ʰ  Ŷ ִ
+    releaseSendPackets();
 
-    RegisteredPacketCount = 0;
+    SendQueueBytes = 0;
+    SendBufferLimit = std::min<uint32_t>(DEFAULT_SEND_BUF_COUNT, Server->mMaxSendBufferCount);
+
+    //  ÷׸ Ѵ - ش  IoCount ٸ ǿ ǵ帱  ֱ⿡ Interlocked ʿ
+    // ʱȭ  ڿ ؾ   ID  (epoll)    Ѵ
+    InterlockedAnd(reinterpret_cast<LONG*>(&IoCount), 0x7FFF'FFFF);
 }
 
 bool Session::DecrementIoCount()
@@ -71,14 +85,98 @@ bool Session::DecrementIoCount()
     InterlockedDecrement(&Server->mSessionCount);
 
     // OnRelease ȣ ٸ   Ͷ    ȸѴ
-    ::PostQueuedCompletionStatus(Server->mIOCP, 0, ID, 0);
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+    ::PostQueuedCompletionStatus(Server->mIOCPs[Server->getIoShardIndex(SessionListKey)], 0, ID, 0);
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+    Server->mReleaseQueue.Enqueue(ID);
+    NetUtils::SignalNotifyEvent(Server->mNotifyEvent);
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+    Server->mReleaseQueue.Enqueue(ID);
+    getRing().PrepareNotify();
+#endif
+
+    if (bIpTracked)
+    {
+        Server->mIpConnectionTable.RemoveConnection(Address.sin_addr.s_addr);
+    }
 
-    //  Ű ε ݳ
-    Server->mUnusedSessionKeys.Push(SessionListKey);
+    // ϼ  Ŷ ִ RecvBuffer ݳѴ (IoCount 0̹Ƿ  ó   )
+    if (RecvBuffer != nullptr)
+    {
+        RecvBuffer->ClearBuffer();
+        Server->mRecvBufferPool.Free(RecvBuffer);
+        RecvBuffer = nullptr;
+    }
+
+    //  ۽ Ŷ  Ű      ʴ´ (IoCount 0̹Ƿ ۽   )
+    releaseSendPackets();
+
+    //  Ű ε ݳ - IoCount    Ȯ  尡   Ƿ  Ⱓ ڿ ȴ
+    Server->retireSessionKey(SessionListKey);
 
     return true;
 }
 
+void Session::acquireRecvBuffer(void)
+{
+    if (RecvBuffer == nullptr)
+    {
+        RecvBuffer = Server->mRecvBufferPool.Alloc();
+    }
+}
+
+void Session::releaseRecvBufferIfEmpty(void)
+{
+    if (RecvBuffer != nullptr && RecvBuffer->GetUseSize() == 0)
+    {
+        RecvBuffer->ClearBuffer();
+        Server->mRecvBufferPool.Free(RecvBuffer);
+        RecvBuffer = nullptr;
+    }
+}
+
+void Session::RefillRecvTokens(const uint32_t currentTick)
+{
+    // ʴ ѵ *  ms = 1/1000  ä 
+    const uint64_t elapsedMs = std::min<uint32_t>(currentTick - RecvTokenTick, 1'000);
+    RecvTokenTick = currentTick;
+
+    const uint64_t maxPacketTokens = static_cast<uint64_t>(Server->mMaxRecvPacketsPerSecond) * 1'000;
+    const uint64_t maxByteTokens = static_cast<uint64_t>(Server->mMaxRecvBytesPerSecond) * 1'000;
+
+    RecvPacketTokens = std::min<uint64_t>(RecvPacketTokens + Server->mMaxRecvPacketsPerSecond * elapsedMs, maxPacketTokens);
+    RecvByteTokens = std::min<uint64_t>(RecvByteTokens + Server->mMaxRecvBytesPerSecond * elapsedMs, maxByteTokens);
+}
+
+bool Session::ConsumeRecvTokens(const uint32_t packetSize)
+{
+    if (Server->mMaxRecvPacketsPerSecond > 0)
+    {
+        if (RecvPacketTokens < 1'000)
+        {
+            return false;
+        }
+
+        RecvPacketTokens -= 1'000;
+    }
+
+    if (Server->mMaxRecvBytesPerSecond > 0)
+    {
+        const uint64_t byteCost = static_cast<uint64_t>(packetSize) * 1'000;
+
+        if (RecvByteTokens < byteCost)
+        {
+            return false;
+        }
+
+        RecvByteTokens -= byteCost;
+    }
+
+    return true;
+}
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+
 bool Session::PostRecv()
 {
     if (bDisconnected || bDisconnectRegistered)
@@ -89,8 +187,17 @@ bool Session::PostRecv()
     WSABUF wsabuf;
     DWORD flags = 0;
 
-    wsabuf.buf = RecvBuffer.GetRearBufferPtr();
-    wsabuf.len = RecvBuffer.GetDirectEnqueueSize();
+    // RecvBuffer ٸ 0Ʈ  Ǵ - Ͱ ϸ Ϸǰ, ׶ ۸ ͼ   Ǵ
+    if (RecvBuffer != nullptr)
+    {
+        wsabuf.buf = RecvBuffer->GetRearBufferPtr();
+        wsabuf.len = RecvBuffer->GetDirectEnqueueSize();
+    }
+    else
+    {
+        wsabuf.buf = nullptr;
+        wsabuf.len = 0;
+    }
 
     ::ZeroMemory(&RecvOverlapped, sizeof(RecvOverlapped));
 
@@ -114,7 +221,7 @@ bool Session::PostRecv()
                 ::CancelIoEx((HANDLE)Socket, NULL);
             }
 
-            InterlockedIncrement(&Server->mMonitoringVariables.RecvPendingTPS);
+            Server->addMonitoringCount(EMonitoringCounter::RecvPending);
         }
         break;
         case WSAECONNRESET:
@@ -140,53 +247,22 @@ bool Session::PostRecv()
 
 bool Session::PostSend()
 {
-    uint32_t sendCount = SendQueue.GetCount();
-
-    if (sendCount <= 0 || bDisconnected || bDisconnectRegistered)
-    {
-        return false;
-    }
-
-    if (InterlockedExchange(&bSendFlag, 1))
+    if (false == registerSendPackets())
     {
         return false;
     }
 
-    sendCount = SendQueue.GetCount();
+    WSABUF wsabuf[MAX_SEND_IOV_COUNT];
+    int wsaBufCount = static_cast<int>(SendBufferCount);
 
-    if (sendCount <= 0)
+    for (int i = 0; i < wsaBufCount; ++i)
     {
-        ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
-
-        return false;
-    }
-
-    WSABUF wsabuf[MAX_WSA_BUF_COUNT];
-    int wsaBufCount;
-
-    for (wsaBufCount = 0; wsaBufCount < MAX_WSA_BUF_COUNT; ++wsaBufCount)
-    {
-        if (sendCount == 0)
-        {
-            break;
-        }
-
-        Serializer* packet;
-        bool retTryDequeue = SendQueue.TryDequeue(packet);
-        ASSERT_LIVE(retTryDequeue, L"SendQueue TryDequeue Failed");
-
-        sendCount--;
-
-        wsabuf[wsaBufCount].buf = packet->GetFullBufferPointer();
-        wsabuf[wsaBufCount].len = packet->GetFullSize();
-
-        RegisteredPackets[RegisteredPacketCount++] = packet;
+        wsabuf[i].buf = SendBuffers[i].Buffer;
+        wsabuf[i].len = SendBuffers[i].Length;
     }
 
     ::ZeroMemory(&SendOverlapped, sizeof(SendOverlapped));
 
-    IncrementIoCount();
-
     PROFILE_BEGIN(L"WSASend");
     int retWSASend = ::WSASend(Socket, wsabuf, wsaBufCount, NULL, 0, &SendOverlapped, NULL);
     PROFILE_END(L"WSASend");
@@ -205,7 +281,7 @@ bool Session::PostSend()
                 ::CancelIoEx((HANDLE)Socket, NULL);
             }
 
-            InterlockedIncrement(&Server->mMonitoringVariables.SendPendingTPS);
+            Server->addMonitoringCount(EMonitoringCounter::SendPending);
         }
         break;
         case WSAECONNRESET:
@@ -229,6 +305,608 @@ bool Session::PostSend()
     return ret;
 }
 
+void Session::CancelIo()
+{
+    ::CancelIoEx(reinterpret_cast<HANDLE>(Socket), NULL);
+}
+
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+
+bool Session::PostRecv()
+{
+    if (bDisconnected || bDisconnectRegistered)
+    {
+        return false;
+    }
+
+    //   -     Ǹ ProcessRecvEvent() ȯѴ
+    IncrementIoCount();
+
+    NetUtils::RegisterEpoll(Socket, Server->mEpolls[Server->getIoShardIndex(SessionListKey)], ID);
+
+    return false;
+}
+
+bool Session::PostSend()
+{
+    if (false == registerSendPackets())
+    {
+        return false;
+    }
+
+    ProcessSendEvent();
+
+    return false;
+}
+
+void Session::CancelIo()
+{
+    //  shutdown EPOLLHUP    ȯŲ
+    ::shutdown(static_cast<int>(Socket), SHUT_RDWR);
+}
+
+void Session::ProcessRecvEvent()
+{
+    // ٸ 尡 ̹ ó ̶  尡 ̹  óѴ
+    if (InterlockedIncrement(&RecvEventCount) != 1)
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        uint32_t seenEventCount = RecvEventCount;
+
+        bool bRecvClose = false;
+
+        while (false == bRecvClosed)
+        {
+            if (bDisconnectRegistered)
+            {
+                bRecvClose = true;
+                break;
+            }
+
+            acquireRecvBuffer();
+
+            int recvSize = std::min(RecvBuffer->GetDirectEnqueueSize(), RecvBuffer->GetFreeSize());
+            if (recvSize <= 0)
+            {
+                // ϼ  Ŷ ۰  
+                bRecvClose = true;
+                break;
+            }
+
+            PROFILE_BEGIN(L"read");
+            ssize_t retRead = ::read(static_cast<int>(Socket), RecvBuffer->GetRearBufferPtr(), recvSize);
+            PROFILE_END(L"read");
+
+            if (retRead > 0)
+            {
+                RecvBuffer->MoveRear(static_cast<int>(retRead));
+
+                if (false == Server->processReceivedPackets(this))
+                {
+                    bRecvClose = true;
+                    break;
+                }
+
+                continue;
+            }
+
+            //  
+            if (retRead == 0)
+            {
+                bRecvClose = true;
+                break;
+            }
+
+            int errorCode = errno;
+            if (errorCode == EAGAIN || errorCode == EWOULDBLOCK)
+            {
+                Server->addMonitoringCount(EMonitoringCounter::RecvPending);
+                break;
+            }
+
+            switch (errorCode)
+            {
+            case EINTR:
+                continue;
+            case ECONNRESET:
+            case ECONNABORTED:
+            case ETIMEDOUT:
+            case EPIPE:
+                break;
+            default:
+                LOGF(ELogLevel::Error, L"read Error (errorCode = %d)", errorCode);
+                break;
+            }
+
+            bRecvClose = true;
+            break;
+        }
+
+        //  غ    ۸ Ǯ ش
+        releaseRecvBufferIfEmpty();
+
+        if (bRecvClose)
+        {
+            bRecvClosed = true;
+
+            //   ȯ - ȣ Ŀ IoCount  Ƿ ⼭  ʴ´
+            DecrementIoCount();
+        }
+
+        if (InterlockedCompareExchange(&RecvEventCount, 0, seenEventCount) == seenEventCount)
+        {
+            break;
+        }
+    }
+}
+
+void Session::ProcessSendEvent()
+{
+    // ٸ 尡 ̹ ó ̶  尡 ̹  óѴ
+    if (InterlockedIncrement(&SendEventCount) != 1)
+    {
+        return;
+    }
+
+    for (;;)
+    {
+        uint32_t seenEventCount = SendEventCount;
+
+        while (SendBufferCount > 0)
+        {
+            ESendResult result = bDisconnectRegistered ? ESendResult::Failed : sendRegisteredPackets();
+
+            if (result == ESendResult::Pending)
+            {
+                Server->addMonitoringCount(EMonitoringCounter::SendPending);
+                break;
+            }
+
+            releaseRegisteredPackets();
+
+            if (result == ESendResult::Failed)
+            {
+                // bSendFlag ÷ ä ּ  ۽ ´
+                CancelIo();
+                DecrementIoCount();
+                break;
+            }
+
+            ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
+
+            DecrementIoCount();
+
+            // ִ Ŷ ̾ 
+            registerSendPackets();
+        }
+
+        if (InterlockedCompareExchange(&SendEventCount, 0, seenEventCount) == seenEventCount)
+        {
+            break;
+        }
+    }
+}
+
+Session::ESendResult Session::sendRegisteredPackets()
+{
+    for (;;)
+    {
+        iovec iov[MAX_SEND_IOV_COUNT];
+        int iovCount = fillSendIov(iov);
+
+        if (iovCount == 0)
+        {
+            return ESendResult::Completed;
+        }
+
+        PROFILE_BEGIN(L"writev");
+        ssize_t retWritev = ::writev(static_cast<int>(Socket), iov, iovCount);
+        PROFILE_END(L"writev");
+
+        if (retWritev >= 0)
+        {
+            SentBytes += static_cast<uint32_t>(retWritev);
+
+            Server->addMonitoringCount(EMonitoringCounter::SendCall);
+            Server->addMonitoringCount(EMonitoringCounter::SendBytes, static_cast<uint32_t>(retWritev));
+            continue;
+        }
+
+        int errorCode = errno;
+        switch (errorCode)
+        {
+        case EAGAIN:
+            return ESendResult::Pending;
+        case EINTR:
+            continue;
+        case ECONNRESET:
+        case ECONNABORTED:
+        case ETIMEDOUT:
+        case EPIPE:
+            return ESendResult::Failed;
+        default:
+            LOGF(ELogLevel::Error, L"writev Error (errorCode = %d)", errorCode);
+            return ESendResult::Failed;
+        }
+    }
+}
+
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+
+bool Session::PostRecv()
+{
+    if (bDisconnected || bDisconnectRegistered)
+    {
+        return false;
+    }
+
+    //   - multishot recv   (Ϸ  IORING_CQE_F_MORE  ) ȯѴ
+    IncrementIoCount();
+
+    getRing().PrepareRecvMultishot(Socket, this);
+
+    Server->addMonitoringCount(EMonitoringCounter::RecvPending);
+
+    return false;
+}
+
+bool Session::PostSend()
+{
+    if (false == registerSendPackets())
+    {
+        return false;
+    }
+
+    SentBytes = 0;
+
+    submitSendMessage();
+
+    Server->addMonitoringCount(EMonitoringCounter::SendPending);
+
+    return false;
+}
+
+void Session::CancelIo()
+{
+    // ɷִ multishot recv 0Ʈ , sendmsg  
+    ::shutdown(static_cast<int>(Socket), SHUT_RDWR);
+}
+
+void Session::ProcessRecvCompletion(const int32_t result, const uint32_t flags)
+{
+    IoUring& ring = getRing();
+
+    if (result > 0)
+    {
+        uint16_t bufferID = static_cast<uint16_t>(flags >> IORING_CQE_BUFFER_SHIFT);
+        const char* data = ring.GetProvidedBuffer(bufferID);
+        int remainSize = result;
+
+        acquireRecvBuffer();
+
+        //  ᰡ ϵ ڿ  ʹ 
+        while (remainSize > 0 && false == bDisconnectRegistered)
+        {
+            int enqueueSize = std::min(remainSize, RecvBuffer->GetFreeSize());
+
+            if (enqueueSize > 0)
+            {
+                RecvBuffer->Enqueue(data, enqueueSize);
+            }
+
+            if (enqueueSize <= 0 || false == Server->processReceivedPackets(this))
+            {
+                // ߸ Ŷ - multishot recv    ´
+                InterlockedExchange8(reinterpret_cast<CHAR*>(&bDisconnectRegistered), true);
+                CancelIo();
+                break;
+            }
+
+            data += enqueueSize;
+            remainSize -= enqueueSize;
+        }
+
+        ring.RecycleProvidedBuffer(bufferID);
+
+        //  Ϸ  provided buffer ͸ Ƿ,  Ͱ ٸ ۸ Ǯ ش
+        releaseRecvBufferIfEmpty();
+    }
+
+    if (flags & IORING_CQE_F_MORE)
+    {
+        return;
+    }
+
+    // multishot recv  - provided buffer (ENOBUFS)ó  ִ    ä ٽ Ǵ
+    bool bRearm = (result > 0 || result == -ENOBUFS) && false == bDisconnected && false == bDisconnectRegistered;
+
+    if (bRearm)
+    {
+        ring.PrepareRecvMultishot(Socket, this);
+        Server->addMonitoringCount(EMonitoringCounter::RecvPending);
+        return;
+    }
+
+    switch (result)
+    {
+    case 0:
+    case -ENOBUFS:
+    case -ECONNRESET:
+    case -ECONNABORTED:
+    case -ETIMEDOUT:
+    case -EPIPE:
+    case -ECANCELED:
+        break;
+    default:
+        if (result < 0)
+        {
+            LOGF(ELogLevel::Error, L"io_uring recv Error (errorCode = %d)", -result);
+        }
+        break;
+    }
+
+    //   ȯ - ȣ Ŀ IoCount  Ƿ ⼭  ʴ´
+    DecrementIoCount();
+}
+
+void Session::ProcessSendCompletion(const int32_t result)
+{
+    // IOCP ۽ п  bSendFlag ÷ ä  ȯѴ (ϵ Ŷ   )
+    if (result < 0)
+    {
+        DecrementIoCount();
+        return;
+    }
+
+    SentBytes += static_cast<uint32_t>(result);
+
+    Server->addMonitoringCount(EMonitoringCounter::SendCall);
+    Server->addMonitoringCount(EMonitoringCounter::SendBytes, static_cast<uint32_t>(result));
+
+    // Ϻθ ٸ  ٽ  (۽  )
+    if (false == bDisconnectRegistered && submitSendMessage())
+    {
+        return;
+    }
+
+    releaseRegisteredPackets();
+
+    if (bDisconnectRegistered)
+    {
+        DecrementIoCount();
+        return;
+    }
+
+    ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
+
+    PostSend();
+
+    DecrementIoCount();
+}
+
+IoUring& Session::getRing() const
+{
+    return Server->mRings[Server->getIoShardIndex(SessionListKey)];
+}
+
+bool Session::submitSendMessage()
+{
+    int iovCount = fillSendIov(SendIov);
+
+    if (iovCount == 0)
+    {
+        return false;
+    }
+
+    //  ̾   Ŷ鸸 Ҵٸ  ۷  (Ŀ ۽Ÿ   ʴ´)
+    const char* remainingBuffer = static_cast<const char*>(SendIov[0].iov_base);
+
+    if (iovCount == 1 && SendSlabBufferIndex != NO_FIXED_BUFFER && remainingBuffer >= SendSlab && remainingBuffer < SendSlab + SEND_SLAB_SIZE)
+    {
+        getRing().PrepareWriteFixed(Socket, SendIov[0].iov_base, static_cast<uint32_t>(SendIov[0].iov_len), SendSlabBufferIndex, this);
+        return true;
+    }
+
+    ::memset(&SendMessage, 0, sizeof(SendMessage));
+    SendMessage.msg_iov = SendIov;
+    SendMessage.msg_iovlen = iovCount;
+
+    getRing().PrepareSendMessage(Socket, &SendMessage, this);
+
+    return true;
+}
+
+#endif
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL || IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+
+int Session::fillSendIov(iovec* iov) const
+{
+    int iovCount = 0;
+    uint32_t skipBytes = SentBytes;
+
+    for (uint32_t i = 0; i < SendBufferCount; ++i)
+    {
+        uint32_t bufferSize = SendBuffers[i].Length;
+
+        if (skipBytes >= bufferSize)
+        {
+            skipBytes -= bufferSize;
+            continue;
+        }
+
+        iov[iovCount].iov_base = SendBuffers[i].Buffer + skipBytes;
+        iov[iovCount].iov_len = bufferSize - skipBytes;
+        iovCount++;
+
+        skipBytes = 0;
+    }
+
+    return iovCount;
+}
+
+#endif
+
+void Session::releaseRegisteredPackets()
+{
+    uint32_t registeredPacketsCount = RegisteredPacketCount;
+    RegisteredPacketCount = 0;
+    SendBufferCount = 0;
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL || IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+    SentBytes = 0;
+#endif
+
+    Server->addMonitoringCount(EMonitoringCounter::SendMessage, registeredPacketsCount + CoalescedPacketCount);
+    CoalescedPacketCount = 0;
+
+    for (uint32_t i = 0; i < registeredPacketsCount; ++i)
+    {
+        RegisteredPackets[i]->DecrementRefCount();
+    }
+
+    if (bDisconnectAfterSend && SendQueue.IsEmpty())
+    {
+        InterlockedExchange8(reinterpret_cast<CHAR*>(&bDisconnectRegistered), true);
+        CancelIo();
+    }
+}
+
+void Session::releaseSendPackets(void)
+{
+    Serializer* packet;
+    while (popSendPacket(packet))
+    {
+        packet->DecrementRefCount();
+    }
+
+    for (uint32_t i = 0; i < RegisteredPacketCount; ++i)
+    {
+        RegisteredPackets[i]->DecrementRefCount();
+    }
+
+    RegisteredPacketCount = 0;
+    CoalescedPacketCount = 0;
+    SendBufferCount = 0;
+}
+
+bool Session::registerSendPackets()
+{
+    uint32_t sendCount = SendQueue.GetCount();
+
+    if (sendCount <= 0 || bDisconnected || bDisconnectRegistered)
+    {
+        return false;
+    }
+
+    if (InterlockedExchange(&bSendFlag, 1))
+    {
+        return false;
+    }
+
+    // ۽  - ۽ Ϸ()  ȯ
+    // SendPacket() IoCount  ʰ Ƿ,  ǵ帮     ȮѴ
+    //  ̶ bSendFlag ÷ ä ּ  ۽ ´ (Init() )
+    if (static_cast<int32_t>(IncrementIoCount()) < 0)
+    {
+        DecrementIoCount();
+        return false;
+    }
+
+    sendCount = SendQueue.GetCount();
+
+    if (sendCount <= 0)
+    {
+        ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
+        DecrementIoCount();
+
+        return false;
+    }
+
+    const uint32_t bufferLimit = SendBufferLimit;
+    const uint32_t coalescingSize = Server->mSendCoalescingSize;
+
+    uint32_t bufferCount = 0;
+    uint32_t packetCount = 0;
+    uint32_t coalescedCount = 0;
+    uint32_t slabUseSize = 0;
+    bool bLastBufferIsSlab = false;
+
+    while (bufferCount < bufferLimit && sendCount > 0)
+    {
+        // DropOldest å SendPacket()    ִ
+        Serializer* packet;
+        if (false == popSendPacket(packet))
+        {
+            sendCount = 0;
+            break;
+        }
+
+        sendCount--;
+
+        uint32_t packetSize = packet->GetFullSize();
+
+        //  Ŷ  ϰ ٷ Ѵ - ޾   Ŷ  ϳ ̾
+        if (packetSize <= coalescingSize && slabUseSize + packetSize <= SEND_SLAB_SIZE && packet->GetBufferCount() == 1)
+        {
+            memcpy(SendSlab + slabUseSize, packet->GetFullBufferPointer(), packetSize);
+            packet->DecrementRefCount();
+
+            if (bLastBufferIsSlab)
+            {
+                SendBuffers[bufferCount - 1].Length += packetSize;
+            }
+            else
+            {
+                SendBuffers[bufferCount++] = { SendSlab + slabUseSize, packetSize };
+                bLastBufferIsSlab = true;
+            }
+
+            slabUseSize += packetSize;
+            coalescedCount++;
+            continue;
+        }
+
+        // ׸Ʈ ̾ Ŷ ġ ʰ   ϳ Ѵ (ѵ Ѵ Ŷ ϳ  ִ´)
+        packet->ForEachBuffer([this, &bufferCount](char* buffer, const uint32_t length) {
+            SendBuffers[bufferCount++] = { buffer, length };
+            });
+
+        RegisteredPackets[packetCount++] = packet;
+        bLastBufferIsSlab = false;
+    }
+
+    //    ٸ ۽   bSendFlag   Ƿ   ٽ ȮѴ
+    if (bufferCount == 0)
+    {
+        ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
+        DecrementIoCount();
+
+        return registerSendPackets();
+    }
+
+    // ѵ ä зִٸ ѵ ø, ѵ 1/4  äٸ δ
+    if (sendCount > 0)
+    {
+        SendBufferLimit = std::min(bufferLimit * 2, Server->mMaxSendBufferCount);
+    }
+    else if (bufferCount * 4 < bufferLimit)
+    {
+        SendBufferLimit = std::max(bufferLimit / 2, std::min<uint32_t>(DEFAULT_SEND_BUF_COUNT, Server->mMaxSendBufferCount));
+    }
+
+    RegisteredPacketCount = packetCount;
+    CoalescedPacketCount = coalescedCount;
+
+    //   ڿ  Ѵ (epoll  ٸ  ProcessSendEvent() )
+    InterlockedExchange(&SendBufferCount, bufferCount);
+
+    return true;
+}
+
 bool Session::TryClosesocket()
 {
     if (InterlockedExchange8((CHAR*)&bDisconnected, true))
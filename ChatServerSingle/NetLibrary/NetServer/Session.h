@@ -1,10 +1,13 @@
 #pragma once
 
+#include <atomic>
 #include <unordered_map>
 #include <stack>
 
-#include "RingBuffer.h"
+#include "IoEngine.h"
+#include "IoUring.h"
 #include "Serializer.h"
+#include "SessionRecvBuffer.h"
 #include "../DataStructure/LockFreeQueue.h"
 
 class NetServer;
@@ -30,39 +33,211 @@ private:
 	// IO Count (Interlocked), 0̶ release
 	bool DecrementIoCount(void);
 
+	// IoCount  ʰ sessionID  ִ ȮѴ - NetServer::mSessionEpoch б  ȿ ȣ 
+	// б  ȿ  Ű  Ƿ, Ȯ ڿ Ǵ  ü ״ ִ
+	// Init() ID  ڿ Release Flag Ƿ Release Flag ID  о Ѵ
+	inline bool IsAliveWithoutPin(const uint64_t sessionID) const
+	{
+		if (*reinterpret_cast<const volatile uint32_t*>(&IoCount) & 0x8000'0000)
+		{
+			return false;
+		}
+
+		if (*reinterpret_cast<const volatile uint64_t*>(&ID) != sessionID)
+		{
+			return false;
+		}
+
+		return false == bDisconnected && false == bDisconnectRegistered;
+	}
+
 	// RecvBuffer  WSARecv() ȣ
+	// epoll  accept  1ȸ ȣǾ  epoll ϰ  (IoCount) ´
+	// io_uring  multishot recv ɰ  (IoCount) ´ (multishot   ٽ ȣ)
 	bool PostRecv(void);
 
 	// SendBuffer  WSASend() ȣ,  bSendFlag WSASend 1ȸ 
 	// WSASend()  Ϸ    Flag 0 ְ ٽ PostSend() ȣ 
+	// epoll  writev() ٷ ,   ´ٸ EPOLLOUT   ̾ 
+	// io_uring  sendmsg ϰ,   ´ٸ Ϸ    ٽ Ѵ
 	bool PostSend(void);
 
+	//  ðŭ  ū ä (ִ 1 з)
+	void RefillRecvTokens(const uint32_t currentTick);
+
+	// Ŷ ϳŭ  ū , ū ڶ false ( ӵ  ʰ)
+	bool ConsumeRecvTokens(const uint32_t packetSize);
+
 	// bDisconnected false, true ϰ  ݴ´
 	bool TryClosesocket(void);
 
+	// ɷִ IO Ѵ (IOCP : CancelIoEx, epoll/io_uring : shutdown)
+	void CancelIo(void);
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	//  غ  ó,    常 read() Ŷ ó Ѵ
+	void ProcessRecvEvent(void);
+
+	// ۽ غ  ó,    常 writev() Ѵ
+	void ProcessSendEvent(void);
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	// recv Ϸ  ó (provided buffer ͸ RecvBuffer ű Ŷ ó)
+	void ProcessRecvCompletion(const int32_t result, const uint32_t flags);
+
+	// sendmsg Ϸ  ó
+	void ProcessSendCompletion(const int32_t result);
+#endif
+
+private:
+
+	// SendQueue ְ   SendQueueBytes Բ Ѵ
+	inline void pushSendPacket(Serializer* packet)
+	{
+		InterlockedAdd(reinterpret_cast<LONG*>(&SendQueueBytes), packet->GetFullSize());
+		SendQueue.Enqueue(packet);
+	}
+
+	inline bool popSendPacket(Serializer*& outPacket)
+	{
+		if (false == SendQueue.TryDequeue(outPacket))
+		{
+			return false;
+		}
+
+		InterlockedAdd(reinterpret_cast<LONG*>(&SendQueueBytes), -static_cast<LONG>(outPacket->GetFullSize()));
+		return true;
+	}
+
+	// ۽ Ŷ ȣȭ  (ù Ŷ ޱ  Chain)
+	inline ENetworkCipher getCipher(void) const { return Cipher.load(std::memory_order_acquire); }
+
+	//   Ŷ  Ǵ Ŷ(Serializer::SetDroppable)   - DropOldest å
+	inline bool popDroppableSendPacket(Serializer*& outPacket)
+	{
+		if (false == SendQueue.TryDequeueIf(outPacket, [](Serializer* packet) { return packet->IsDroppable(); }))
+		{
+			return false;
+		}
+
+		InterlockedAdd(reinterpret_cast<LONG*>(&SendQueueBytes), -static_cast<LONG>(outPacket->GetFullSize()));
+		return true;
+	}
+
+	// RecvBuffer ٸ Ǯ ´
+	void acquireRecvBuffer(void);
+
+	// RecvBuffer ִٸ Ǯ ݳѴ (ϼ  Ŷ ִٸ   ִ´)
+	void releaseRecvBufferIfEmpty(void);
+
+	// SendQueue Ŷ SendBuffers ϰ ۽ (IoCount) ´, bSendFlag 1ȸ 
+	//  Ŷ SendSlab ̾ ٿ  ϳ , ۽ 1ȸ   ѵ и 翡  Ѵ
+	bool registerSendPackets(void);
+
+	// ϵ Ŷ  ϰ ۽   
+	// SendAndDisconnect()  Ŷ  ´ٸ ⼭  Ḧ Ѵ
+	void releaseRegisteredPackets(void);
+
+	// SendQueue  Ŷ ϵ Ŷ   Ѵ - ۽  尡   ( , Init()) ȣ
+	void releaseSendPackets(void);
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	enum class ESendResult
+	{
+		Completed,	// ϵ Ŷ  
+		Pending,	//  ۽ ۰   (EPOLLOUT )
+		Failed		//  
+	};
+
+	// ϵ Ŷ SentBytes ĺ writev() 
+	ESendResult sendRegisteredPackets(void);
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	//   
+	IoUring& getRing(void) const;
+
+	// ϵ ۽ ۵  SentBytes ĸ sendmsg Ѵ,   ٸ false
+	//    ۷ ϵ SendSlab ϳ̶ write_fixed Ѵ
+	bool submitSendMessage(void);
+#endif
+
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL || IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	// ϵ ۽ ۵  SentBytes ĸ iov ä ä  ȯѴ
+	int fillSendIov(iovec* iov) const;
+#endif
+
 private:
 
 	enum
 	{
-		MAX_WSA_BUF_COUNT = 10
+		DEFAULT_SEND_BUF_COUNT = 10,	// ۽ 1ȸ    ѵ  
+		MAX_SEND_BUF_COUNT = 64,		// ۽ 1ȸ   ִ   
+		MAX_SEND_IOV_COUNT = MAX_SEND_BUF_COUNT + Serializer::MAX_BUFFER_COUNT - 1,	// ׸Ʈ ̾ Ŷ    ϹǷ  ׸ŭ   ִ
+		SEND_SLAB_SIZE = 4096,			//  Ŷ ̾ ̴ Ǻ ۽  ũ
+		NO_FIXED_BUFFER = UINT16_MAX,	// SendSlabBufferIndex - SendSlab   ۷ ϵ 
+		CACHE_LINE_SIZE = 64			// 帶       ´ (false sharing )
+	};
+
+	// ۽ 1ȸ ѱ ӵ ޸ ϳ (Ŷ ϳ, Ǵ SendSlab ̾  Ŷ)
+	struct SendBuffer
+	{
+		char*		Buffer;
+		uint32_t	Length;
 	};
 	
+	/************************** cold -   ( ù Ŷ ȣȭ )  ķδ б⸸ Ѵ **************************/
+	alignas(CACHE_LINE_SIZE)
 	uint64_t					ID;			// [SessionList key(index) 32bit][ID++ 32bit]	
 	SOCKET						Socket;
 	SOCKADDR_IN					Address;
 	NetServer*					Server;
-
-	OVERLAPPED					SendOverlapped;
-	OVERLAPPED					RecvOverlapped;
-	
+	uint32_t					SessionListKey;
+	bool						bIpTracked;				// IP    ִ° (release  IpConnectionTable )
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	uint16_t					SendSlabBufferIndex;	// SendSlab ִ    ĭ (  ε, ٸ NO_FIXED_BUFFER)
+#endif
+	char*						SendSlab = nullptr;		//  Ŷ ۽  -      (SetSendCoalescingSize() 0̶ nullptr)
+	std::atomic<ENetworkCipher>	Cipher;					// ۽ ȣȭ  -  尡 ù Ŷ   ϰ (release), SendPacket() б⸸ Ѵ (acquire)
+
+	/************************** hot atomic - SendPacket() θ  尡 Interlocked  **************************/
+	alignas(CACHE_LINE_SIZE)
 	uint32_t					IoCount;	// IoCount ֻ Ʈ Release Flag 
 	uint32_t					bSendFlag;
-	uint32_t					SessionListKey;
+	uint32_t					bSendDirty;	//  ۽  - FlushSends() ٸ  (NetServer Ͽ  )
+	uint32_t					SendQueueBytes;			// SendQueue  Ŷ Ʈ  ( )
 	bool						bDisconnected;
 	bool						bDisconnectRegistered;
-
-	RingBuffer					RecvBuffer;
+	bool						bDisconnectAfterSend;	// SendAndDisconnect() - SendQueue    Ḧ Ѵ
 	LockFreeQueue<Serializer*>	SendQueue;
-	uint32_t					RegisteredPacketCount;
-	Serializer*					RegisteredPackets[MAX_WSA_BUF_COUNT];
+
+	/************************** send - bSendFlag  常  **************************/
+	alignas(CACHE_LINE_SIZE)
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+	OVERLAPPED					SendOverlapped;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	uint32_t					SendEventCount;	// ó  ۽   (0 ƴ϶  尡 ۽ ó )
+	uint32_t					SentBytes;		// ϵ Ŷ  ̹  Ʈ 
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_URING
+	uint32_t					SentBytes;		// ϵ Ŷ  ̹  Ʈ 
+	msghdr						SendMessage;	//  sendmsg  (Ϸ  )
+	iovec						SendIov[MAX_SEND_IOV_COUNT];
+#endif
+	uint32_t					SendBufferLimit;		// ۽ 1ȸ   ѵ (и ð, Ѱϸ ش)
+	uint32_t					SendBufferCount;		// ϵ ۽   (0 ƴ϶ ۽ )
+	uint32_t					RegisteredPacketCount = 0;	// ۽ ۰  Ű ִ Ŷ  ( ,  ÿ Init() Ƿ ó 0)
+	uint32_t					CoalescedPacketCount;	// SendSlab ϰ  ٷ  Ŷ 
+	SendBuffer					SendBuffers[MAX_SEND_IOV_COUNT];
+	Serializer*					RegisteredPackets[MAX_SEND_BUF_COUNT];
+
+	/************************** recv -    常  ó Ѵ **************************/
+	alignas(CACHE_LINE_SIZE)
+#if IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_IOCP
+	OVERLAPPED					RecvOverlapped;
+#elif IO_ENGINE_USE_TYPE == IO_ENGINE_TYPE_EPOLL
+	uint32_t					RecvEventCount;	// ó     (0 ƴ϶  尡  ó )
+	bool						bRecvClosed;	//  (IoCount) ȯߴ°
+#endif
+	uint32_t					RecvTokenTick;			//  ū  ä ð
+	uint8_t						RecvHeaderCode;			// ù Ŷ   ڵ -  Ŷ  ڵ忩 Ѵ (0̶  ù Ŷ )
+	uint64_t					RecvPacketTokens;		//   Ŷ ū (1/1000 )
+	uint64_t					RecvByteTokens;			//   Ʈ ū (1/1000Ʈ )
+	SessionRecvBuffer*			RecvBuffer = nullptr;	//   (Ͱ ׿ ְų  ɷ   Ǯ ´, ƴϸ nullptr)
 };
\ No newline at end of file
@@ -0,0 +1,213 @@
+////////////////////////////////////////////////
+// Session  ġ Ȯΰ SendPacket()  
+// 1.  ° ĳ  ϰ, SendPacket() θ  ǵ帮 (S)
+//     尡  (R)  ο ִٸ з 
+// 2. N ۽ 尡  ǿ SendPacket()  Ȯ/ (IoCount, ID, Cipher, SendQueueBytes) ݺϴ 
+//      ϳ    (ū,  ڵ)   -  Session,      ٿ ü Ѵ
+// Session private   Ƿ -Dprivate=public Ѵ
+// Ʈ  ʴ ܵ  , ġ Ȯο ϸ 1 ȯѴ
+// Linux : g++ -std=c++17 -O2 -Dprivate=public -I../.. SessionLayoutBench.cpp ../Platform/LinuxCompat.cpp ../Logger/Logger.cpp ../CrashDump/CrashDump.cpp -o SessionLayoutBench -lpthread
+//         ./SessionLayoutBench [ITERATIONS=5000000]
+//  ھ   巯 - ھ ϳ   ⸸ ϹǷ  ġ ̰ 
+////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include "Session.h"
+
+namespace
+{
+    enum class EAccess
+    {
+        Sender,     // SendPacket() θ  尡 аų 
+        Receiver,   //  尡 
+        Other,      // ۽   ϳ  ( ʰ   )
+    };
+
+    struct FieldLayout
+    {
+        const char* Name;
+        size_t Offset;
+        size_t Size;
+        EAccess Access;
+    };
+
+#define SESSION_FIELD(Name, Access) FieldLayout{ #Name, offsetof(Session, Name), sizeof(Session::Name), Access }
+
+    bool auditLayout(void)
+    {
+        const FieldLayout fields[] = {
+            SESSION_FIELD(ID, EAccess::Sender),
+            SESSION_FIELD(Server, EAccess::Sender),
+            SESSION_FIELD(SendSlab, EAccess::Other),
+            SESSION_FIELD(Cipher, EAccess::Sender),
+            SESSION_FIELD(IoCount, EAccess::Sender),
+            SESSION_FIELD(bSendFlag, EAccess::Sender),
+            SESSION_FIELD(bSendDirty, EAccess::Sender),
+            SESSION_FIELD(SendQueueBytes, EAccess::Sender),
+            SESSION_FIELD(bDisconnected, EAccess::Sender),
+            SESSION_FIELD(SendQueue, EAccess::Sender),
+            SESSION_FIELD(SendBufferLimit, EAccess::Other),
+            SESSION_FIELD(SendBufferCount, EAccess::Other),
+            SESSION_FIELD(RegisteredPackets, EAccess::Other),
+            SESSION_FIELD(RecvTokenTick, EAccess::Receiver),
+            SESSION_FIELD(RecvHeaderCode, EAccess::Receiver),
+            SESSION_FIELD(RecvPacketTokens, EAccess::Receiver),
+            SESSION_FIELD(RecvByteTokens, EAccess::Receiver),
+            SESSION_FIELD(RecvBuffer, EAccess::Receiver),
+        };
+
+        wprintf(L"sizeof(Session) = %zu, alignof(Session) = %zu\n", sizeof(Session), alignof(Session));
+        wprintf(L"%-20ls %8ls %6ls %6ls  %ls\n", L"field", L"offset", L"size", L"line", L"access");
+
+        for (const FieldLayout& field : fields)
+        {
+            const wchar_t* access = field.Access == EAccess::Sender ? L"S" : (field.Access == EAccess::Receiver ? L"R" : L"-");
+            wprintf(L"%-20hs %8zu %6zu %6zu  %ls\n", field.Name, field.Offset, field.Size, field.Offset / Session::CACHE_LINE_SIZE, access);
+        }
+
+        bool bIsSeparated = true;
+
+        for (const FieldLayout& sender : fields)
+        {
+            if (sender.Access != EAccess::Sender)
+            {
+                continue;
+            }
+
+            for (const FieldLayout& receiver : fields)
+            {
+                if (receiver.Access != EAccess::Receiver)
+                {
+                    continue;
+                }
+
+                //    ִ   ġ
+                size_t senderFirst = sender.Offset / Session::CACHE_LINE_SIZE;
+                size_t senderLast = (sender.Offset + sender.Size - 1) / Session::CACHE_LINE_SIZE;
+                size_t receiverFirst = receiver.Offset / Session::CACHE_LINE_SIZE;
+                size_t receiverLast = (receiver.Offset + receiver.Size - 1) / Session::CACHE_LINE_SIZE;
+
+                if (senderFirst <= receiverLast && receiverFirst <= senderLast)
+                {
+                    wprintf(L"FAIL %hs (S) shares a cache line with %hs (R)\n", sender.Name, receiver.Name);
+                    bIsSeparated = false;
+                }
+            }
+        }
+
+        return bIsSeparated;
+    }
+
+#undef SESSION_FIELD
+
+    //   ó   ٿ 񱳿 ġ
+    struct PackedSessionFields
+    {
+        uint64_t ID;
+        std::atomic<ENetworkCipher> Cipher;
+        uint32_t IoCount;
+        uint32_t SendQueueBytes;
+        uint32_t RecvTokenTick;
+        uint8_t RecvHeaderCode;
+        uint64_t RecvPacketTokens;
+        uint64_t RecvByteTokens;
+    };
+
+    // ۽  senderCount iterations      (ns)
+    template <typename SessionType>
+    double measureContention(SessionType* session, const uint32_t senderCount, const uint64_t iterations)
+    {
+        std::atomic<bool> bIsStopped{ false };
+        std::atomic<uint64_t> sink{ 0 };
+
+        session->ID = 42;
+        session->IoCount = 1;
+        session->Cipher.store(ENetworkCipher::Chain, std::memory_order_relaxed);
+
+        //  ó - ū ä  ڵ Ȯ
+        std::thread recvThread([session, &bIsStopped, &sink]()
+            {
+                uint32_t tick = 0;
+                uint64_t localSink = 0;
+
+                while (false == bIsStopped.load(std::memory_order_relaxed))
+                {
+                    session->RecvTokenTick = ++tick;
+                    session->RecvPacketTokens += 3;
+                    session->RecvByteTokens += 7;
+                    session->RecvHeaderCode = static_cast<uint8_t>(tick);
+                    std::atomic_signal_fence(std::memory_order_seq_cst);
+                    localSink += session->RecvHeaderCode;
+                }
+
+                sink += localSink;
+            });
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        std::vector<std::thread> senderThreads;
+        for (uint32_t i = 0; i < senderCount; ++i)
+        {
+            senderThreads.emplace_back([session, iterations, &sink]()
+                {
+                    uint64_t localSink = 0;
+
+                    //  Ȯ(ID, Cipher) + SendQueue  + ۽ 
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        InterlockedIncrement(&session->IoCount);
+                        localSink += (*reinterpret_cast<volatile uint64_t*>(&session->ID) == 42);
+                        localSink += static_cast<uint8_t>(session->Cipher.load(std::memory_order_acquire));
+                        InterlockedAdd(reinterpret_cast<LONG*>(&session->SendQueueBytes), 100);
+                        InterlockedAdd(reinterpret_cast<LONG*>(&session->SendQueueBytes), -100);
+                        InterlockedDecrement(&session->IoCount);
+                    }
+
+                    sink += localSink;
+                });
+        }
+
+        for (std::thread& senderThread : senderThreads)
+        {
+            senderThread.join();
+        }
+
+        double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+
+        bIsStopped = true;
+        recvThread.join();
+
+        return elapsedNs / (static_cast<double>(iterations) * senderCount);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const uint64_t iterations = argc > 1 ? strtoull(argv[1], nullptr, 10) : 5'000'000;
+
+    bool bIsSeparated = auditLayout();
+
+    Session* session = new Session;
+    PackedSessionFields* packedSession = new PackedSessionFields{};
+
+    wprintf(L"\ncontention (ns per SendPacket() access set, %u hardware threads)\n", std::thread::hardware_concurrency());
+
+    for (uint32_t senderCount : { 1u, 2u, 4u })
+    {
+        double sessionNs = measureContention(session, senderCount, iterations);
+        double packedNs = measureContention(packedSession, senderCount, iterations);
+
+        wprintf(L"  %u sender(s) : Session %.1f ns, packed %.1f ns\n", senderCount, sessionNs, packedNs);
+    }
+
+    delete packedSession;
+    delete session;
+
+    wprintf(L"SessionLayoutBench : layout %ls\n", bIsSeparated ? L"OK" : L"FAILED");
+    return bIsSeparated ? 0 : 1;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "MirroredRingBuffer.h"
+#include "RingBuffer.h"
+
+#define RECV_BUFFER_TYPE_RING     0 // RingBuffer :  ߸ Ŷ ̾ ٿ Ѵ
+#define RECV_BUFFER_TYPE_MIRRORED 1 // MirroredRingBuffer : Ŷ ߸ ʴ´ (Windows    Ǵ 64KB)
+
+#ifndef RECV_BUFFER_USE_TYPE
+
+#ifdef _WIN32
+#define RECV_BUFFER_USE_TYPE RECV_BUFFER_TYPE_RING
+#else
+#define RECV_BUFFER_USE_TYPE RECV_BUFFER_TYPE_MIRRORED
+#endif
+
+#endif
+
+//    - Ǹ   ʰ, Ͱ ׿ ְų  ɷ ִ ȸ NetServer Ǯ  
+#if RECV_BUFFER_USE_TYPE == RECV_BUFFER_TYPE_MIRRORED
+typedef MirroredRingBuffer SessionRecvBuffer;
+#else
+typedef RingBuffer SessionRecvBuffer;
+#endif
@@ -0,0 +1,471 @@
+////////////////////////////////////////////////
+//  /Ű   Ȯ
+// ۽  ִ ǰ ̹    SendPacket/SendPacketToMany/Disconnect/SendAndDisconnect ϴ 
+// Ŭ̾Ʈ  Ӱ Ḧ ݺؼ  Ű  ȸǰ ٽ ̰ Ѵ
+// - Ǹ  Ŷ   ID ִ´, Ŭ̾Ʈ Accept   ڱ ID ٸ Ŷ  ߸ ޵  
+//   (IsAliveWithoutPin() Ȯ    ǰ Ű ٽ µ Ŷ    )
+// -      Ŷ(canary)   ƿ; Ѵ (Ű ٽ       ȴ)
+// -    ȸ    Ű(retireSessionKey/reclaimSessionKeys, EpochDomain  Ⱓ)  ʾƾ Ѵ
+// -   ִ  ŭ     ־ Ѵ (ȸ Ű  ٽ   ִ)
+// NetServer ȸ  ť Ŷ  īƮ  Ƿ -Dprivate=public Ѵ
+// Ʈ  ʴ ܵ  , Linux ,  Ȯ ִٸ 1 ȯѴ
+//
+//  (io_uring -DIO_ENGINE_USE_TYPE=2 ߰)
+//   g++ -std=c++17 -O2 -Dprivate=public -I../.. SessionReuseStressTest.cpp NetServer.cpp Session.cpp IoUring.cpp MirroredRingBuffer.cpp IpConnectionTable.cpp
+//       ../Platform/LinuxCompat.cpp ../Logger/Logger.cpp ../CrashDump/CrashDump.cpp ../Profiler/Profiler.cpp -o SessionReuseStressTest -lpthread
+// 
+//   ./SessionReuseStressTest PORT [SECONDS=10] [CLIENTS=64] [COALESCING_SIZE=0]
+////////////////////////////////////////////////
+
+#include <atomic>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <poll.h>
+
+#include "NetServer.h"
+#include "PacketView.h"
+
+static int g_failCount = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { wprintf(L"FAIL %hs:%d %hs\n", __FILE__, __LINE__, #Condition); g_failCount++; } } while (0)
+
+namespace
+{
+    constexpr uint32_t MAX_SESSION_COUNT = 512;
+    constexpr uint32_t SENDER_THREAD_COUNT = 3;
+    constexpr uint32_t PICK_COUNT = 16;
+    constexpr uint32_t CANARY_PAYLOAD_SIZE = 3000;
+
+    //   ID  Ŷ
+    Serializer* allocIdPacket(const uint64_t sessionID)
+    {
+        Serializer* packet = Serializer::Alloc();
+        packet->InsertByte(reinterpret_cast<const char*>(&sessionID), sizeof(sessionID));
+        return packet;
+    }
+
+    ////////////////////////////////////////////////
+    // ִ ǰ ֱٿ   صδ 
+    ////////////////////////////////////////////////
+    class StressServer : public NetServer
+    {
+    public:
+        // 1/4 ̹    (ٸ 0)
+        uint64_t PickSessionID(std::mt19937& random)
+        {
+            std::lock_guard<std::mutex> lock(mSessionLock);
+
+            if (false == mReleasedSessionIDs.empty() && (random() & 3) == 0)
+            {
+                return mReleasedSessionIDs[random() % mReleasedSessionIDs.size()];
+            }
+
+            return mLiveSessionIDs.empty() ? 0 : mLiveSessionIDs[random() % mLiveSessionIDs.size()];
+        }
+
+    private:
+        // ڱ ID   ڿ Ͽ ִ´ - ۽   Ŷ ׻  ڿ Ѵ
+        void OnAccept(const uint64_t sessionID) override
+        {
+            Serializer* packet = allocIdPacket(sessionID);
+            SendPacket(sessionID, packet);
+            Serializer::Free(packet);
+
+            std::lock_guard<std::mutex> lock(mSessionLock);
+            mLiveSessionIDs.push_back(sessionID);
+        }
+
+        void OnReceive(const uint64_t sessionID, PacketView& packet) override
+        {
+            (void)packet;
+
+            Serializer* reply = allocIdPacket(sessionID);
+            SendPacket(sessionID, reply);
+            Serializer::Free(reply);
+        }
+
+        void OnRelease(const uint64_t sessionID) override
+        {
+            std::lock_guard<std::mutex> lock(mSessionLock);
+
+            for (uint64_t& liveSessionID : mLiveSessionIDs)
+            {
+                if (liveSessionID == sessionID)
+                {
+                    liveSessionID = mLiveSessionIDs.back();
+                    mLiveSessionIDs.pop_back();
+                    break;
+                }
+            }
+
+            mReleasedSessionIDs.push_back(sessionID);
+            if (mReleasedSessionIDs.size() > 4096)
+            {
+                mReleasedSessionIDs.erase(mReleasedSessionIDs.begin(), mReleasedSessionIDs.begin() + 2048);
+            }
+        }
+
+        std::mutex mSessionLock;
+        std::vector<uint64_t> mLiveSessionIDs;
+        std::vector<uint64_t> mReleasedSessionIDs;
+    };
+
+    struct ClientResult
+    {
+        std::atomic<uint64_t> ConnectCount{ 0 };
+        std::atomic<uint64_t> IdPacketCount{ 0 };
+        std::atomic<uint64_t> CanaryPacketCount{ 0 };
+        std::atomic<uint64_t> MisdeliveredCount{ 0 };
+        std::atomic<uint64_t> CorruptedCount{ 0 };
+    };
+
+    // NET  + ü ȣȭ Ŷ ϳ (RandKey )
+    std::vector<unsigned char> makeEncodedPacket(const std::vector<unsigned char>& payload)
+    {
+        const unsigned char randKey = 0x5A;
+
+        std::vector<unsigned char> plain;
+        plain.push_back(0);
+
+        uint32_t checkSum = 0;
+        for (unsigned char value : payload)
+        {
+            plain.push_back(value);
+            checkSum += value;
+        }
+        plain[0] = static_cast<unsigned char>(checkSum);
+
+        std::vector<unsigned char> packet = { NETWORK_HEADER_CODE, static_cast<unsigned char>(payload.size()), static_cast<unsigned char>(payload.size() >> 8), randKey };
+
+        unsigned char prevRandValue = 0;
+        unsigned char prevEncodedValue = 0;
+        for (uint32_t i = 0; i < plain.size(); ++i)
+        {
+            prevRandValue = plain[i] ^ static_cast<unsigned char>(prevRandValue + randKey + i + 1);
+            prevEncodedValue = prevRandValue ^ static_cast<unsigned char>(prevEncodedValue + NETWORK_HEADER_FIXED_KEY + i + 1);
+            packet.push_back(prevEncodedValue);
+        }
+
+        return packet;
+    }
+
+    // üũ ̷ε  ڸ ȣȭϰ üũ ´ ȯѴ
+    bool decodePacket(unsigned char* encoded, const uint32_t length, const unsigned char randKey)
+    {
+        unsigned char prevRandValue = 0;
+        unsigned char prevEncodedValue = 0;
+        unsigned char checkSum = 0;
+
+        for (uint32_t i = 0; i < length; ++i)
+        {
+            unsigned char randValue = encoded[i] ^ static_cast<unsigned char>(prevEncodedValue + NETWORK_HEADER_FIXED_KEY + i + 1);
+            prevEncodedValue = encoded[i];
+            encoded[i] = randValue ^ static_cast<unsigned char>(prevRandValue + randKey + i + 1);
+            prevRandValue = randValue;
+
+            if (i > 0)
+            {
+                checkSum += encoded[i];
+            }
+        }
+
+        return checkSum == encoded[0];
+    }
+
+    //  Ʈ ϼ Ŷ  ȮѴ, ù ID Ŷ ڱ ID
+    void consumePackets(std::vector<unsigned char>& stream, uint64_t& ownSessionID, ClientResult& result)
+    {
+        size_t offset = 0;
+
+        while (stream.size() - offset >= sizeof(NetworkHeader))
+        {
+            unsigned char* header = stream.data() + offset;
+            uint16_t payloadLength = static_cast<uint16_t>(header[1] | (header[2] << 8));
+
+            if (header[0] != NETWORK_HEADER_CODE)
+            {
+                result.CorruptedCount++;
+                stream.clear();
+                return;
+            }
+
+            if (stream.size() - offset < sizeof(NetworkHeader) + payloadLength)
+            {
+                break;
+            }
+
+            // RandKey  üũ ȣȭ
+            if (false == decodePacket(header + 4, payloadLength + 1, header[3]))
+            {
+                result.CorruptedCount++;
+            }
+            else if (payloadLength == sizeof(uint64_t))
+            {
+                uint64_t sessionID;
+                memcpy(&sessionID, header + sizeof(NetworkHeader), sizeof(sessionID));
+
+                if (ownSessionID == 0)
+                {
+                    ownSessionID = sessionID;
+                }
+                else if (sessionID != ownSessionID)
+                {
+                    result.MisdeliveredCount++;
+                }
+
+                result.IdPacketCount++;
+            }
+            else if (payloadLength == CANARY_PAYLOAD_SIZE)
+            {
+                result.CanaryPacketCount++;
+            }
+            else
+            {
+                result.CorruptedCount++;
+            }
+
+            offset += sizeof(NetworkHeader) + payloadLength;
+        }
+
+        stream.erase(stream.begin(), stream.begin() + offset);
+    }
+
+    //  -> ( Ŷ Ǵ  Ŷ ۽) -> 0~20ms ޱ -> Ḧ ݺѴ
+    void runClient(const uint16_t port, const uint32_t seed, const std::atomic<bool>& bIsStopped, ClientResult& result)
+    {
+        std::mt19937 random(seed);
+        const std::vector<unsigned char> validPacket = makeEncodedPacket({ 1, 2, 3, 4 });
+        const unsigned char garbagePacket[] = { NETWORK_HEADER_CODE, 2, 0, 0, 0, 1, 2 };
+
+        sockaddr_in serverAddress{};
+        serverAddress.sin_family = AF_INET;
+        serverAddress.sin_port = htons(port);
+        serverAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        std::vector<unsigned char> stream;
+        unsigned char recvBuffer[8192];
+
+        while (false == bIsStopped.load())
+        {
+            int sock = ::socket(AF_INET, SOCK_STREAM, 0);
+
+            //  ۸ ۰ Ƽ  SendQueue и Ѵ
+            int recvBufferSize = 4096;
+            ::setsockopt(sock, SOL_SOCKET, SO_RCVBUF, &recvBufferSize, sizeof(recvBufferSize));
+
+            if (::connect(sock, reinterpret_cast<sockaddr*>(&serverAddress), sizeof(serverAddress)) == 0)
+            {
+                result.ConnectCount++;
+
+                //  Ŷ üũ Ʋ   ´
+                if ((random() & 7) == 0)
+                {
+                    ::send(sock, garbagePacket, sizeof(garbagePacket), MSG_NOSIGNAL);
+                }
+                else
+                {
+                    ::send(sock, validPacket.data(), validPacket.size(), MSG_NOSIGNAL);
+                }
+
+                uint64_t ownSessionID = 0;
+                stream.clear();
+
+                auto closeTime = std::chrono::steady_clock::now() + std::chrono::microseconds(random() % 20'000);
+                while (std::chrono::steady_clock::now() < closeTime)
+                {
+                    pollfd pollInfo{ sock, POLLIN, 0 };
+                    if (::poll(&pollInfo, 1, 1) <= 0)
+                    {
+                        continue;
+                    }
+
+                    ssize_t recvSize = ::recv(sock, recvBuffer, sizeof(recvBuffer), MSG_DONTWAIT);
+                    if (recvSize <= 0)
+                    {
+                        break;
+                    }
+
+                    stream.insert(stream.end(), recvBuffer, recvBuffer + recvSize);
+                    consumePackets(stream, ownSessionID, result);
+                }
+            }
+
+            ::close(sock);
+        }
+    }
+
+    //   ų ´ -    ̿ Ǿ  ִ
+    void runSender(StressServer& server, Serializer* canary, const uint32_t seed, const std::atomic<bool>& bIsStopped, std::atomic<uint64_t>& sendCount)
+    {
+        std::mt19937 random(seed);
+        uint64_t sessionIDs[PICK_COUNT];
+
+        while (false == bIsStopped.load())
+        {
+            for (uint64_t& sessionID : sessionIDs)
+            {
+                sessionID = server.PickSessionID(random);
+            }
+
+            switch (random() % 20)
+            {
+            case 0:
+                server.Disconnect(sessionIDs[0]);
+                break;
+            case 1:
+            {
+                Serializer* packet = allocIdPacket(sessionIDs[0]);
+                server.SendAndDisconnect(sessionIDs[0], packet);
+                Serializer::Free(packet);
+                break;
+            }
+            case 2:
+            case 3:
+            case 4:
+                server.SendPacketToMany(sessionIDs, PICK_COUNT, canary);
+                sendCount += PICK_COUNT;
+                break;
+            default:
+            {
+                Serializer* packet = allocIdPacket(sessionIDs[0]);
+                server.SendPacket(sessionIDs[0], packet);
+                Serializer::Free(packet);
+
+                server.SendPacket(sessionIDs[1], canary);
+                sendCount += 2;
+                break;
+            }
+            }
+        }
+    }
+
+    //      ٸ (ִ 5)
+    bool waitForSessionCount(StressServer& server, const uint32_t sessionCount)
+    {
+        for (uint32_t i = 0; i < 50; ++i)
+        {
+            if (server.GetSessionCount() == sessionCount)
+            {
+                return true;
+            }
+
+            ::Sleep(100);
+        }
+
+        return server.GetSessionCount() == sessionCount;
+    }
+
+    // ִ  ŭ   ؼ  ޾
+    bool connectFullTable(StressServer& server, const uint16_t port)
+    {
+        sockaddr_in serverAddress{};
+        serverAddress.sin_family = AF_INET;
+        serverAddress.sin_port = htons(port);
+        serverAddress.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+        std::vector<int> sockets;
+        for (uint32_t i = 0; i < MAX_SESSION_COUNT; ++i)
+        {
+            int sock = ::socket(AF_INET, SOCK_STREAM, 0);
+            if (::connect(sock, reinterpret_cast<sockaddr*>(&serverAddress), sizeof(serverAddress)) != 0)
+            {
+                ::close(sock);
+                continue;
+            }
+
+            sockets.push_back(sock);
+        }
+
+        bool bIsAllAccepted = waitForSessionCount(server, MAX_SESSION_COUNT);
+
+        for (int sock : sockets)
+        {
+            ::close(sock);
+        }
+
+        return bIsAllAccepted && waitForSessionCount(server, 0);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2)
+    {
+        wprintf(L"usage: %hs PORT [SECONDS=10] [CLIENTS=64] [COALESCING_SIZE=0]\n", argv[0]);
+        return 1;
+    }
+
+    const uint16_t port = static_cast<uint16_t>(atoi(argv[1]));
+    const uint32_t seconds = argc > 2 ? static_cast<uint32_t>(atoi(argv[2])) : 10;
+    const uint32_t clientCount = argc > 3 ? static_cast<uint32_t>(atoi(argv[3])) : 64;
+    const uint32_t coalescingSize = argc > 4 ? static_cast<uint32_t>(atoi(argv[4])) : 0;
+
+    StressServer server;
+    server.SetTcpNodelay(true);
+    server.SetAcceptThreadCount(2);
+    server.SetSendCoalescingSize(coalescingSize);
+    server.SetMaxSendQueueCount(64);
+    server.SetSendOverflowPolicy(ESendOverflowPolicy::DropNewest);
+    server.Start(port, MAX_SESSION_COUNT, 2, 2);
+
+    //  ۽ 尡   ū Ŷ
+    Serializer* canary = Serializer::Alloc(CANARY_PAYLOAD_SIZE);
+    std::vector<char> canaryPayload(CANARY_PAYLOAD_SIZE, 0x3C);
+    canary->InsertByte(canaryPayload.data(), CANARY_PAYLOAD_SIZE);
+
+    std::atomic<bool> bIsStopped{ false };
+    std::atomic<uint64_t> sendCount{ 0 };
+    ClientResult clientResult;
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < SENDER_THREAD_COUNT; ++i)
+    {
+        threads.emplace_back([&, i]() { runSender(server, canary, i * 7 + 1, bIsStopped, sendCount); });
+    }
+
+    for (uint32_t i = 0; i < clientCount; ++i)
+    {
+        threads.emplace_back([&, i]() { runClient(port, i + 100, bIsStopped, clientResult); });
+    }
+
+    ::Sleep(seconds * 1'000);
+    bIsStopped = true;
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    //   Ǹ canary ó   ϳ ƾ Ѵ
+    CHECK(waitForSessionCount(server, 0));
+    ::Sleep(300);
+    uint32_t canaryRefCount = canary->mRefCount;
+
+    //  Ⱓ    ȸ   Ű  Ѵ
+    ::Sleep(1'200);
+    uint32_t retiredKeyCount = server.mRetiredSessionKeys.GetCount();
+    size_t graceKeyCount = server.mGraceSessionKeys.size();
+
+    wprintf(L"connects %llu  accepted %llu  sends %llu  id packets %llu  canary packets %llu\n",
+        clientResult.ConnectCount.load(), server.GetTotalAcceptCount(), sendCount.load(), clientResult.IdPacketCount.load(), clientResult.CanaryPacketCount.load());
+    wprintf(L"misdelivered %llu  corrupted %llu  canary refs %u  retired keys %u  grace keys %zu\n",
+        clientResult.MisdeliveredCount.load(), clientResult.CorruptedCount.load(), canaryRefCount, retiredKeyCount, graceKeyCount);
+
+    CHECK(clientResult.MisdeliveredCount == 0);
+    CHECK(clientResult.CorruptedCount == 0);
+    CHECK(clientResult.IdPacketCount > 0);
+    CHECK(canaryRefCount == 1);
+    CHECK(retiredKeyCount == 0);
+    CHECK(graceKeyCount == 0);
+    CHECK(connectFullTable(server, port));
+
+    Serializer::Free(canary);
+    server.Shutdown();
+
+    wprintf(L"SessionReuseStressTest : %ls\n", g_failCount == 0 ? L"OK" : L"FAILED");
+    return g_failCount == 0 ? 0 : 1;
+}
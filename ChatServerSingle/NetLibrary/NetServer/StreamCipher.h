@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cstdint>
+
+#include "NetworkHeader.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define STREAM_CIPHER_USE_AVX2
+#endif
+
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#include <emmintrin.h>
+#define STREAM_CIPHER_USE_SSE2
+#endif
+
+////////////////////////////////////////////////
+// Ű Ʈ ȣȭ (ENetworkCipher::Stream)
+// ġ i(üũ Ʈ 0, ̷ε 1) Ű KEY_TABLE[(RandKey + i / 256) % 256][i % 256] -  Ʈ   ʴ´
+// ׷ XOR üũ( Ʈ )   鼭 16Ʈ(SSE2), 32Ʈ(AVX2 ) óѴ
+// Ű ǥ 256 x 256 Ʈ, NETWORK_HEADER_FIXED_KEY ó     
+////////////////////////////////////////////////
+class StreamCipher final
+{
+public:
+    StreamCipher() = delete;
+
+    enum
+    {
+        KEY_ROW_SIZE = 256,     // Ű ǥ   - ġ   Ѿ  RandKey  
+        KEY_ROW_COUNT = 256     // RandKey ϳ  
+    };
+
+    // position ġ Ű  Ʈ
+    inline static uint8_t GetKey(const uint8_t randKey, const uint32_t position)
+    {
+        return getKeyRow(randKey, position)[position % KEY_ROW_SIZE];
+    }
+
+    // data(position ġ length Ʈ) ȣȭѴ - ȣȭϱ   Ʈ  checkSum ؼ ش
+    inline static uint8_t Encode(unsigned char* data, const uint32_t length, const uint8_t randKey, const uint32_t position, const uint8_t checkSum)
+    {
+        return apply<true>(data, length, randKey, position, checkSum);
+    }
+
+    // data(position ġ length Ʈ) ȣȭѴ - ȣȭ  Ʈ  checkSum ؼ ش
+    inline static uint8_t Decode(unsigned char* data, const uint32_t length, const uint8_t randKey, const uint32_t position, const uint8_t checkSum)
+    {
+        return apply<false>(data, length, randKey, position, checkSum);
+    }
+
+private:
+    struct KeyTable
+    {
+        alignas(64) unsigned char Key[KEY_ROW_COUNT][KEY_ROW_SIZE];
+
+        KeyTable(void)
+        {
+            // ٸ ٸ õ xorshift32 - 0  ʵ Ȧ  Ѵ
+            for (uint32_t row = 0; row < KEY_ROW_COUNT; ++row)
+            {
+                uint32_t state = (row + 1) * 0x9E3779B9u + NETWORK_HEADER_FIXED_KEY;
+
+                for (uint32_t i = 0; i < KEY_ROW_SIZE; ++i)
+                {
+                    state ^= state << 13;
+                    state ^= state >> 17;
+                    state ^= state << 5;
+                    Key[row][i] = static_cast<unsigned char>(state >> 24);
+                }
+            }
+        }
+    };
+
+    inline static const unsigned char* getKeyRow(const uint8_t randKey, const uint32_t position)
+    {
+        static const KeyTable keyTable;
+
+        return keyTable.Key[static_cast<uint8_t>(randKey + position / KEY_ROW_SIZE)];
+    }
+
+    template <bool bEncode>
+    inline static uint8_t apply(unsigned char* data, uint32_t length, const uint8_t randKey, uint32_t position, uint8_t checkSum)
+    {
+        // Ű ǥ   ȿ  óѴ (Ű    ״ е)
+        while (length > 0)
+        {
+            const uint32_t rowOffset = position % KEY_ROW_SIZE;
+            const uint32_t blockLength = (KEY_ROW_SIZE - rowOffset) < length ? (KEY_ROW_SIZE - rowOffset) : length;
+
+            checkSum += applyBlock<bEncode>(data, getKeyRow(randKey, position) + rowOffset, blockLength);
+
+            data += blockLength;
+            position += blockLength;
+            length -= blockLength;
+        }
+
+        return checkSum;
+    }
+
+    // data ^= key,  Ʈ  (mod 256) ش
+    template <bool bEncode>
+    inline static uint8_t applyBlock(unsigned char* data, const unsigned char* key, const uint32_t length)
+    {
+        uint32_t i = 0;
+        uint64_t sum = 0;
+
+#ifdef STREAM_CIPHER_USE_AVX2
+        __m256i sum256 = _mm256_setzero_si256();
+
+        for (; i + 32 <= length; i += 32)
+        {
+            const __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            const __m256i result = _mm256_xor_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key + i)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(data + i), result);
+
+            // Ʈ  0 SAD Ѵ (8Ʈ 64Ʈ ĭ )
+            sum256 = _mm256_add_epi64(sum256, _mm256_sad_epu8(bEncode ? value : result, _mm256_setzero_si256()));
+        }
+
+        alignas(32) uint64_t sum256Lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(sum256Lanes), sum256);
+        sum += sum256Lanes[0] + sum256Lanes[1] + sum256Lanes[2] + sum256Lanes[3];
+#endif
+
+#ifdef STREAM_CIPHER_USE_SSE2
+        __m128i sum128 = _mm_setzero_si128();
+
+        for (; i + 16 <= length; i += 16)
+        {
+            const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+            const __m128i result = _mm_xor_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(key + i)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), result);
+
+            sum128 = _mm_add_epi64(sum128, _mm_sad_epu8(bEncode ? value : result, _mm_setzero_si128()));
+        }
+
+        sum += static_cast<uint32_t>(_mm_cvtsi128_si32(sum128)) + static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(sum128, 8)));
+#endif
+
+        //  Ʈ (SIMD ٸ )
+        for (; i < length; ++i)
+        {
+            const unsigned char value = data[i];
+            data[i] = value ^ key[i];
+            sum += bEncode ? value : data[i];
+        }
+
+        return static_cast<uint8_t>(sum);
+    }
+};
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////
+// StreamCipher Ȯ - SIMD ó ȣȭ/ȣȭ üũ Ʈ ϳ ó (GetKey() ) 
+// Ű ǥ  (256Ʈ) RandKey  ȣ    (255 -> 0), ĵ  ,   óϴ 츦 
+// Ʈ  ʴ ܵ  ,  Ȯ ִٸ 1 ȯѴ
+// Linux : g++ -std=c++17 -O2 -I../.. StreamCipherTest.cpp -o StreamCipherTest
+//         (AVX2 δ -mavx2 ؼ    Ѵ)
+////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <cwchar>
+#include <vector>
+
+#include "StreamCipher.h"
+
+static int g_failCount = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { wprintf(L"FAIL %hs:%d %hs\n", __FILE__, __LINE__, #Condition); g_failCount++; } } while (0)
+
+static uint32_t g_randomState = 0x6C07'8965;
+
+static uint32_t nextRandom(void)
+{
+    g_randomState ^= g_randomState << 13;
+    g_randomState ^= g_randomState >> 17;
+    g_randomState ^= g_randomState << 5;
+    return g_randomState;
+}
+
+// Ʈ ϳ - ġ GetKey() XORϰ  Ʈ Ѵ
+static uint8_t applyScalar(unsigned char* data, const uint32_t length, const uint8_t randKey, const uint32_t position, uint8_t checkSum, const bool bEncode)
+{
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        const unsigned char value = data[i];
+        data[i] = value ^ StreamCipher::GetKey(randKey, position + i);
+        checkSum += bEncode ? value : data[i];
+    }
+
+    return checkSum;
+}
+
+//   ó  Ʈ   , ȣȭϸ  ƿ
+static bool checkParity(const uint32_t length, const uint8_t randKey, const uint32_t position, const uint32_t alignOffset)
+{
+    std::vector<unsigned char> storage(length + 64);
+    unsigned char* data = storage.data() + alignOffset;
+
+    std::vector<unsigned char> plain(length);
+    for (unsigned char& value : plain)
+    {
+        value = static_cast<unsigned char>(nextRandom() >> 24);
+    }
+
+    std::vector<unsigned char> expected = plain;
+    const uint8_t initialCheckSum = static_cast<uint8_t>(nextRandom());
+    const uint8_t expectedCheckSum = applyScalar(expected.data(), length, randKey, position, initialCheckSum, true);
+
+    std::copy(plain.begin(), plain.end(), data);
+    const uint8_t encodeCheckSum = StreamCipher::Encode(data, length, randKey, position, initialCheckSum);
+
+    bool bIsSame = encodeCheckSum == expectedCheckSum && std::equal(expected.begin(), expected.end(), data);
+
+    // ȣȭ   ش - ȣȭ  հ ƾ Ѵ
+    const uint8_t decodeCheckSum = StreamCipher::Decode(data, length, randKey, position, initialCheckSum);
+
+    bIsSame = bIsSame && decodeCheckSum == expectedCheckSum && std::equal(plain.begin(), plain.end(), data);
+
+    // Ʈ ϳ ȣȭ ͵ ƾ Ѵ
+    std::copy(expected.begin(), expected.end(), data);
+    const uint8_t scalarDecodeCheckSum = applyScalar(data, length, randKey, position, initialCheckSum, false);
+
+    return bIsSame && scalarDecodeCheckSum == expectedCheckSum && std::equal(plain.begin(), plain.end(), data);
+}
+
+// / ġ/RandKey/ ٲ㰡 
+static void testParityAcrossRows(void)
+{
+    const uint32_t lengths[] = { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 255, 256, 257, 511, 512, 513, 1'000, 4'096, 8'191, 65'535 };
+    const uint32_t positions[] = { 0, 1, 15, 200, 255, 256, 257, 4'095, 65'280 };
+    const uint8_t randKeys[] = { 0x00, 0x01, 0x7F, 0xFE, 0xFF };
+
+    for (uint32_t length : lengths)
+    {
+        for (uint32_t position : positions)
+        {
+            for (uint8_t randKey : randKeys)
+            {
+                const uint32_t alignOffset = nextRandom() % 32;
+
+                if (false == checkParity(length, randKey, position, alignOffset))
+                {
+                    wprintf(L"  length %u position %u randKey %u align %u\n", length, position, randKey, alignOffset);
+                    CHECK(false);
+                }
+            }
+        }
+    }
+}
+
+// (׸Ʈ)  óص   ó Ͱ  - ġ üũ ̾ ѱ
+static void testSplitEncode(void)
+{
+    for (uint32_t round = 0; round < 2'000; ++round)
+    {
+        const uint32_t length = nextRandom() % 20'000;
+        const uint8_t randKey = static_cast<uint8_t>(nextRandom());
+
+        std::vector<unsigned char> whole(length);
+        for (unsigned char& value : whole)
+        {
+            value = static_cast<unsigned char>(nextRandom());
+        }
+
+        std::vector<unsigned char> split = whole;
+
+        // Ŷó ġ 1(üũ )
+        const uint8_t wholeCheckSum = StreamCipher::Encode(whole.data(), length, randKey, 1, 0);
+
+        uint32_t offset = 0;
+        uint8_t splitCheckSum = 0;
+        while (offset < length)
+        {
+            uint32_t pieceLength = 1 + nextRandom() % 5'000;
+            if (pieceLength > length - offset)
+            {
+                pieceLength = length - offset;
+            }
+
+            splitCheckSum = StreamCipher::Encode(split.data() + offset, pieceLength, randKey, 1 + offset, splitCheckSum);
+            offset += pieceLength;
+        }
+
+        CHECK(splitCheckSum == wholeCheckSum);
+        CHECK(split == whole);
+    }
+}
+
+// Ű ǥ -  ϳ RandKey ϳ, ġ     (255  0)
+static void testKeyRows(void)
+{
+    bool bIsRowDifferent = false;
+
+    for (uint32_t i = 0; i < StreamCipher::KEY_ROW_SIZE; ++i)
+    {
+        CHECK(StreamCipher::GetKey(0xFF, StreamCipher::KEY_ROW_SIZE + i) == StreamCipher::GetKey(0x00, i));
+        CHECK(StreamCipher::GetKey(0x10, StreamCipher::KEY_ROW_SIZE * 3 + i) == StreamCipher::GetKey(0x13, i));
+        CHECK(StreamCipher::GetKey(0x01, StreamCipher::KEY_ROW_SIZE * 256 + i) == StreamCipher::GetKey(0x01, i));
+
+        if (StreamCipher::GetKey(0x00, i) != StreamCipher::GetKey(0x01, i))
+        {
+            bIsRowDifferent = true;
+        }
+    }
+
+    CHECK(bIsRowDifferent);
+}
+
+int main(void)
+{
+    testParityAcrossRows();
+    testSplitEncode();
+    testKeyRows();
+
+#if defined(STREAM_CIPHER_USE_AVX2)
+    const wchar_t* path = L"AVX2 + SSE2";
+#elif defined(STREAM_CIPHER_USE_SSE2)
+    const wchar_t* path = L"SSE2";
+#else
+    const wchar_t* path = L"scalar";
+#endif
+
+    wprintf(L"StreamCipherTest (%ls) : %ls\n", path, g_failCount == 0 ? L"OK" : L"FAILED");
+    return g_failCount == 0 ? 0 : 1;
+}
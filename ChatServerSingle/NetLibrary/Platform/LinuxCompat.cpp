@@ -0,0 +1,704 @@
+#ifndef _WIN32
+
+#include <atomic>
+#include <cstdarg>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+#include <sys/resource.h>
+
+#include "LinuxCompat.h"
+
+namespace
+{
+    enum class EHandleType
+    {
+        Thread,
+        Event,
+        WaitableTimer,
+    };
+
+    struct CompatHandle
+    {
+        EHandleType Type;
+    };
+
+    struct ThreadHandle : CompatHandle
+    {
+        pthread_t   Thread;
+        bool        bJoined;
+    };
+
+    struct ThreadStartParam
+    {
+        unsigned    (*StartAddress)(void*);
+        void*       Argument;
+    };
+
+    struct EventHandle : CompatHandle
+    {
+        bool                bManualReset;
+        std::atomic<bool>   bSignaled;
+    };
+
+    struct TimerHandle : CompatHandle
+    {
+        bool        bManualReset;
+        bool        bActive;
+        uint64_t    DueTime;    // CLOCK_MONOTONIC ns
+        uint64_t    Period;     // ns, 0̶ 1ȸ
+    };
+
+    // ̺Ʈ/Ÿ̸  ϳ   óѴ (ϴ   ٴ )
+    std::mutex              g_waitLock;
+    std::condition_variable g_waitCondition;
+
+    uint64_t getMonotonicNano(void)
+    {
+        timespec now;
+        ::clock_gettime(CLOCK_MONOTONIC, &now);
+        return static_cast<uint64_t>(now.tv_sec) * 1'000'000'000 + now.tv_nsec;
+    }
+
+    void* threadTrampoline(void* param)
+    {
+        ThreadStartParam startParam = *reinterpret_cast<ThreadStartParam*>(param);
+        delete reinterpret_cast<ThreadStartParam*>(param);
+
+        startParam.StartAddress(startParam.Argument);
+
+        return nullptr;
+    }
+
+    // g_waitLock  ¿ ȣ, ȣ ¶ Һϰ true ȯ
+    bool tryConsumeSignal(CompatHandle* handle, const uint64_t now)
+    {
+        switch (handle->Type)
+        {
+        case EHandleType::Event:
+        {
+            EventHandle* event = static_cast<EventHandle*>(handle);
+
+            if (false == event->bSignaled.load())
+            {
+                return false;
+            }
+
+            if (false == event->bManualReset)
+            {
+                event->bSignaled.store(false);
+            }
+
+            return true;
+        }
+        case EHandleType::WaitableTimer:
+        {
+            TimerHandle* timer = static_cast<TimerHandle*>(handle);
+
+            if (false == timer->bActive || now < timer->DueTime)
+            {
+                return false;
+            }
+
+            if (timer->Period == 0)
+            {
+                timer->bActive = timer->bManualReset;
+            }
+            else
+            {
+                timer->DueTime += timer->Period;
+
+                // и ֱ   ȣ ģ
+                if (timer->DueTime <= now)
+                {
+                    timer->DueTime = now + timer->Period;
+                }
+            }
+
+            return true;
+        }
+        default:
+            return false;
+        }
+    }
+}
+
+namespace
+{
+    void setFileTime(LPFILETIME outTime, const uint64_t time100ns)
+    {
+        outTime->dwLowDateTime = static_cast<DWORD>(time100ns);
+        outTime->dwHighDateTime = static_cast<DWORD>(time100ns >> 32);
+    }
+}
+
+void GetSystemTimeAsFileTime(LPFILETIME outTime)
+{
+    timespec now;
+    ::clock_gettime(CLOCK_REALTIME, &now);
+    setFileTime(outTime, static_cast<uint64_t>(now.tv_sec) * 10'000'000 + now.tv_nsec / 100);
+}
+
+BOOL GetSystemTimes(PFILETIME outIdleTime, PFILETIME outKernelTime, PFILETIME outUserTime)
+{
+    FILE* file = ::fopen("/proc/stat", "r");
+    if (file == nullptr)
+    {
+        return FALSE;
+    }
+
+    // cpu user nice system idle iowait irq softirq ( : clock tick)
+    unsigned long long user, nice, system, idle, iowait, irq, softirq;
+    int retScan = ::fscanf(file, "cpu %llu %llu %llu %llu %llu %llu %llu", &user, &nice, &system, &idle, &iowait, &irq, &softirq);
+    ::fclose(file);
+
+    if (retScan != 7)
+    {
+        return FALSE;
+    }
+
+    const uint64_t tickTo100ns = 10'000'000 / static_cast<uint64_t>(::sysconf(_SC_CLK_TCK));
+    const uint64_t idleTime = (idle + iowait) * tickTo100ns;
+
+    setFileTime(outIdleTime, idleTime);
+    setFileTime(outKernelTime, (system + irq + softirq) * tickTo100ns + idleTime);
+    setFileTime(outUserTime, (user + nice) * tickTo100ns);
+
+    return TRUE;
+}
+
+HANDLE GetCurrentProcess(void)
+{
+    // Windows  ǻ ڵ
+    return reinterpret_cast<HANDLE>(-1);
+}
+
+BOOL GetProcessTimes(HANDLE process, LPFILETIME outCreationTime, LPFILETIME outExitTime, LPFILETIME outKernelTime, LPFILETIME outUserTime)
+{
+    if (process != GetCurrentProcess())
+    {
+        return FALSE;
+    }
+
+    rusage usage;
+    if (::getrusage(RUSAGE_SELF, &usage) == -1)
+    {
+        return FALSE;
+    }
+
+    setFileTime(outCreationTime, 0);
+    setFileTime(outExitTime, 0);
+    setFileTime(outKernelTime, static_cast<uint64_t>(usage.ru_stime.tv_sec) * 10'000'000 + usage.ru_stime.tv_usec * 10);
+    setFileTime(outUserTime, static_cast<uint64_t>(usage.ru_utime.tv_sec) * 10'000'000 + usage.ru_utime.tv_usec * 10);
+
+    return TRUE;
+}
+
+DWORD GetCurrentThreadId(void)
+{
+    return static_cast<DWORD>(::syscall(SYS_gettid));
+}
+
+DWORD GetCurrentProcessId(void)
+{
+    return static_cast<DWORD>(::getpid());
+}
+
+DWORD GetLastError(void)
+{
+    return static_cast<DWORD>(errno);
+}
+
+HANDLE _beginthreadex(void* security, unsigned stackSize, unsigned (*startAddress)(void*), void* argument, unsigned initFlag, unsigned* outThreadID)
+{
+    ThreadHandle* handle = new ThreadHandle;
+    handle->Type = EHandleType::Thread;
+    handle->bJoined = false;
+
+    ThreadStartParam* startParam = new ThreadStartParam{ startAddress, argument };
+
+    pthread_attr_t attribute;
+    ::pthread_attr_init(&attribute);
+
+    if (stackSize != 0)
+    {
+        ::pthread_attr_setstacksize(&attribute, stackSize);
+    }
+
+    int retCreate = ::pthread_create(&handle->Thread, &attribute, threadTrampoline, startParam);
+
+    ::pthread_attr_destroy(&attribute);
+
+    if (retCreate != 0)
+    {
+        delete startParam;
+        delete handle;
+        return nullptr;
+    }
+
+    return handle;
+}
+
+HANDLE CreateEvent(void* eventAttributes, BOOL bManualReset, BOOL bInitialState, const WCHAR* name)
+{
+    EventHandle* handle = new EventHandle;
+    handle->Type = EHandleType::Event;
+    handle->bManualReset = bManualReset;
+    handle->bSignaled.store(bInitialState);
+
+    return handle;
+}
+
+BOOL SetEvent(HANDLE event)
+{
+    EventHandle* handle = reinterpret_cast<EventHandle*>(event);
+
+    // ̹ ȣ ¶   ʴ´ (Ŀ 尡 ޽ ȣ)
+    if (handle->bSignaled.load())
+    {
+        return TRUE;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(g_waitLock);
+        handle->bSignaled.store(true);
+    }
+
+    g_waitCondition.notify_all();
+
+    return TRUE;
+}
+
+BOOL ResetEvent(HANDLE event)
+{
+    std::lock_guard<std::mutex> guard(g_waitLock);
+    reinterpret_cast<EventHandle*>(event)->bSignaled.store(false);
+
+    return TRUE;
+}
+
+HANDLE CreateWaitableTimer(void* timerAttributes, BOOL bManualReset, const WCHAR* name)
+{
+    TimerHandle* handle = new TimerHandle;
+    handle->Type = EHandleType::WaitableTimer;
+    handle->bManualReset = bManualReset;
+    handle->bActive = false;
+    handle->DueTime = 0;
+    handle->Period = 0;
+
+    return handle;
+}
+
+BOOL SetWaitableTimer(HANDLE timer, const LARGE_INTEGER* dueTime, LONG period, void* completionRoutine, void* argToCompletionRoutine, BOOL bResume)
+{
+    TimerHandle* handle = reinterpret_cast<TimerHandle*>(timer);
+    uint64_t now = getMonotonicNano();
+
+    {
+        std::lock_guard<std::mutex> guard(g_waitLock);
+
+        if (dueTime->QuadPart < 0)
+        {
+            handle->DueTime = now + static_cast<uint64_t>(-dueTime->QuadPart) * 100;
+        }
+        else
+        {
+            handle->DueTime = now;
+        }
+
+        handle->Period = static_cast<uint64_t>(period) * 1'000'000;
+        handle->bActive = true;
+    }
+
+    g_waitCondition.notify_all();
+
+    return TRUE;
+}
+
+DWORD WaitForSingleObject(HANDLE handle, DWORD milliseconds)
+{
+    CompatHandle* compatHandle = reinterpret_cast<CompatHandle*>(handle);
+
+    if (compatHandle->Type == EHandleType::Thread)
+    {
+        ThreadHandle* thread = static_cast<ThreadHandle*>(compatHandle);
+
+        if (false == thread->bJoined)
+        {
+            ::pthread_join(thread->Thread, nullptr);
+            thread->bJoined = true;
+        }
+
+        return WAIT_OBJECT_0;
+    }
+
+    return WaitForMultipleObjects(1, &handle, FALSE, milliseconds);
+}
+
+DWORD WaitForMultipleObjects(DWORD count, const HANDLE* handles, BOOL bWaitAll, DWORD milliseconds)
+{
+    const uint64_t startTime = getMonotonicNano();
+    const uint64_t timeoutTime = milliseconds == INFINITE ? UINT64_MAX : startTime + static_cast<uint64_t>(milliseconds) * 1'000'000;
+
+    std::unique_lock<std::mutex> guard(g_waitLock);
+
+    for (;;)
+    {
+        uint64_t now = getMonotonicNano();
+        uint64_t wakeTime = timeoutTime;
+
+        for (DWORD i = 0; i < count; ++i)
+        {
+            CompatHandle* handle = reinterpret_cast<CompatHandle*>(handles[i]);
+
+            if (tryConsumeSignal(handle, now))
+            {
+                return WAIT_OBJECT_0 + i;
+            }
+
+            if (handle->Type == EHandleType::WaitableTimer)
+            {
+                TimerHandle* timer = static_cast<TimerHandle*>(handle);
+
+                if (timer->bActive && timer->DueTime < wakeTime)
+                {
+                    wakeTime = timer->DueTime;
+                }
+            }
+        }
+
+        if (now >= timeoutTime)
+        {
+            return WAIT_TIMEOUT;
+        }
+
+        if (wakeTime == UINT64_MAX)
+        {
+            g_waitCondition.wait(guard);
+        }
+        else
+        {
+            g_waitCondition.wait_for(guard, std::chrono::nanoseconds(wakeTime - now));
+        }
+    }
+}
+
+BOOL CloseHandle(HANDLE handle)
+{
+    if (handle == nullptr || handle == INVALID_HANDLE_VALUE)
+    {
+        return FALSE;
+    }
+
+    CompatHandle* compatHandle = reinterpret_cast<CompatHandle*>(handle);
+
+    switch (compatHandle->Type)
+    {
+    case EHandleType::Thread:
+    {
+        ThreadHandle* thread = static_cast<ThreadHandle*>(compatHandle);
+
+        if (false == thread->bJoined)
+        {
+            ::pthread_detach(thread->Thread);
+        }
+
+        delete thread;
+    }
+    break;
+    case EHandleType::Event:
+        delete static_cast<EventHandle*>(compatHandle);
+        break;
+    case EHandleType::WaitableTimer:
+        delete static_cast<TimerHandle*>(compatHandle);
+        break;
+    }
+
+    return TRUE;
+}
+
+int _kbhit(void)
+{
+    pollfd stdinPoll{};
+    stdinPoll.fd = STDIN_FILENO;
+    stdinPoll.events = POLLIN;
+
+    return ::poll(&stdinPoll, 1, 0) > 0 ? 1 : 0;
+}
+
+int _getch(void)
+{
+    return ::getchar();
+}
+
+std::string WideToUtf8(const WCHAR* source)
+{
+    std::string ret;
+
+    for (; *source != L'\0'; ++source)
+    {
+        uint32_t codePoint = static_cast<uint32_t>(*source);
+
+        if (codePoint < 0x80)
+        {
+            ret.push_back(static_cast<char>(codePoint));
+        }
+        else if (codePoint < 0x800)
+        {
+            ret.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+            ret.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else if (codePoint < 0x1'0000)
+        {
+            ret.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+            ret.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            ret.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+        else
+        {
+            ret.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+            ret.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+            ret.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+            ret.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+        }
+    }
+
+    return ret;
+}
+
+namespace
+{
+    // sscanf_s  sscanf  ٲٸ鼭  ڵ 
+    // ϴ ڿ ȯ (, ũ)  ڸ   ũ  Ѵ
+    //  ߸Ǿų ڰ ʹ ų ũⰡ 0 ۰ ִٸ false
+    template <typename CharType>
+    bool buildBoundedScanFormat(const CharType* format, va_list args, std::basic_string<CharType>& outFormat, void* (&outArgs)[SCANF_S_MAX_ARG_COUNT])
+    {
+        int argCount = 0;
+
+        while (*format != 0)
+        {
+            outFormat.push_back(*format);
+
+            if (*format++ != '%')
+            {
+                continue;
+            }
+
+            if (*format == '%')
+            {
+                outFormat.push_back(*format++);
+                continue;
+            }
+
+            const bool bSuppressed = (*format == '*');
+            if (bSuppressed)
+            {
+                outFormat.push_back(*format++);
+            }
+
+            unsigned long width = 0;
+            while (*format >= '0' && *format <= '9')
+            {
+                width = width * 10 + static_cast<unsigned long>(*format++ - '0');
+            }
+
+            std::basic_string<CharType> lengthModifier;
+            while (*format == 'h' || *format == 'l' || *format == 'j' || *format == 'z' || *format == 't' || *format == 'L')
+            {
+                lengthModifier.push_back(*format++);
+            }
+
+            const CharType conversion = *format;
+            if (conversion == 0)
+            {
+                return false;
+            }
+
+            if (false == bSuppressed)
+            {
+                if (argCount == SCANF_S_MAX_ARG_COUNT)
+                {
+                    return false;
+                }
+
+                outArgs[argCount++] = va_arg(args, void*);
+
+                if (conversion == 's' || conversion == 'c' || conversion == '[')
+                {
+                    const unsigned int bufferSize = va_arg(args, unsigned int);
+
+                    // %s, %[   ڸ , %c  ڸ  ʴ´ (  1)
+                    const unsigned long maxWidth = (conversion == 'c') ? bufferSize : bufferSize - 1ul;
+
+                    if (bufferSize == 0 || maxWidth == 0)
+                    {
+                        return false;
+                    }
+
+                    if ((width == 0 && conversion != 'c') || width > maxWidth)
+                    {
+                        width = maxWidth;
+                    }
+                }
+            }
+
+            if (width > 0)
+            {
+                for (const char digit : std::to_string(width))
+                {
+                    outFormat.push_back(static_cast<CharType>(digit));
+                }
+            }
+
+            outFormat += lengthModifier;
+            outFormat.push_back(*format++);
+
+            // ĵ  ']' ״ ű (  ']' տ )
+            if (conversion == '[')
+            {
+                if (*format == '^')
+                {
+                    outFormat.push_back(*format++);
+                }
+
+                if (*format == ']')
+                {
+                    outFormat.push_back(*format++);
+                }
+
+                while (*format != ']')
+                {
+                    if (*format == 0)
+                    {
+                        return false;
+                    }
+
+                    outFormat.push_back(*format++);
+                }
+
+                outFormat.push_back(*format++);
+            }
+        }
+
+        return true;
+    }
+}
+
+int sscanf_s(const char* buffer, const char* format, ...)
+{
+    std::string boundedFormat;
+    void* args[SCANF_S_MAX_ARG_COUNT]{};
+
+    va_list argList;
+    va_start(argList, format);
+    const bool bIsValidFormat = buildBoundedScanFormat(format, argList, boundedFormat, args);
+    va_end(argList);
+
+    if (false == bIsValidFormat)
+    {
+        errno = EINVAL;
+        return 0;
+    }
+
+    // Ŀ  ʴ  ڴ õȴ
+    return ::sscanf(buffer, boundedFormat.c_str(), args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]);
+}
+
+int swscanf_s(const WCHAR* buffer, const WCHAR* format, ...)
+{
+    std::wstring boundedFormat;
+    void* args[SCANF_S_MAX_ARG_COUNT]{};
+
+    va_list argList;
+    va_start(argList, format);
+    const bool bIsValidFormat = buildBoundedScanFormat(format, argList, boundedFormat, args);
+    va_end(argList);
+
+    if (false == bIsValidFormat)
+    {
+        errno = EINVAL;
+        return 0;
+    }
+
+    return ::swscanf(buffer, boundedFormat.c_str(), args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]);
+}
+
+errno_t _wfopen_s(FILE** outFile, const WCHAR* fileName, const WCHAR* mode)
+{
+    std::string narrowFileName = WideToUtf8(fileName);
+    std::string narrowMode = WideToUtf8(mode);
+
+    *outFile = nullptr;
+
+    if (narrowMode.find('r') == std::string::npos)
+    {
+        return fopen_s(outFile, narrowFileName.c_str(), narrowMode.c_str());
+    }
+
+    FILE* source = ::fopen(narrowFileName.c_str(), "rb");
+    if (source == nullptr)
+    {
+        return errno;
+    }
+
+    unsigned char bom[2]{};
+    size_t bomSize = ::fread(bom, 1, sizeof(bom), source);
+
+    // Windows WCHAR  д UTF-16LE  wchar_t(4Ʈ) Ʈ ٲ㼭 Ѱش
+    if (bomSize != 2 || bom[0] != 0xFF || bom[1] != 0xFE)
+    {
+        ::rewind(source);
+        *outFile = source;
+        return 0;
+    }
+
+    FILE* converted = ::tmpfile();
+    if (converted == nullptr)
+    {
+        ::fclose(source);
+        return errno;
+    }
+
+    WCHAR bomCharacter = 0xFEFF;
+    ::fwrite(&bomCharacter, sizeof(WCHAR), 1, converted);
+
+    unsigned char unit[2];
+    uint32_t highSurrogate = 0;
+
+    while (::fread(unit, 1, sizeof(unit), source) == sizeof(unit))
+    {
+        uint32_t codeUnit = unit[0] | (static_cast<uint32_t>(unit[1]) << 8);
+
+        if (codeUnit >= 0xD800 && codeUnit <= 0xDBFF)
+        {
+            highSurrogate = codeUnit;
+            continue;
+        }
+
+        WCHAR character;
+
+        if (codeUnit >= 0xDC00 && codeUnit <= 0xDFFF && highSurrogate != 0)
+        {
+            character = static_cast<WCHAR>(0x1'0000 + ((highSurrogate - 0xD800) << 10) + (codeUnit - 0xDC00));
+        }
+        else
+        {
+            character = static_cast<WCHAR>(codeUnit);
+        }
+
+        highSurrogate = 0;
+
+        ::fwrite(&character, sizeof(WCHAR), 1, converted);
+    }
+
+    ::fclose(source);
+    ::rewind(converted);
+
+    *outFile = converted;
+
+    return 0;
+}
+
+#endif
@@ -0,0 +1,379 @@
+///////////////////////////////////////////////////////////////////////////////
+// Linux ȣȯ 
+// NetLibrary ChatServer ϴ Win32 API κ  POSIX Ѵ.
+// Windows 忡 Ŭ  ʴ´.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cwchar>
+#include <ctime>
+#include <string>
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#pragma region ⺻ Ÿ
+
+typedef int                 BOOL;
+typedef uint8_t             BYTE;
+typedef char                CHAR;
+typedef uint16_t            WORD;
+typedef uint32_t            DWORD;
+typedef uint64_t            DWORD64;
+typedef int32_t             LONG;
+typedef int64_t             LONG64;
+typedef int64_t             LONGLONG;
+typedef uint64_t            ULONGLONG;
+typedef uintptr_t           ULONG_PTR;
+typedef void*               PVOID;
+typedef void*               LPVOID;
+typedef void*               HANDLE;
+typedef wchar_t             WCHAR;
+typedef int                 errno_t;
+typedef unsigned long long  SOCKET;
+
+#ifndef FALSE
+#define FALSE 0
+#endif
+
+#ifndef TRUE
+#define TRUE 1
+#endif
+
+#define INFINITE                0xFFFF'FFFF
+#define INVALID_HANDLE_VALUE    (reinterpret_cast<HANDLE>(-1))
+#define WAIT_OBJECT_0           0
+#define WAIT_TIMEOUT            258
+#define WAIT_FAILED             0xFFFF'FFFF
+#define MAX_PATH                260
+#define _MAX_PATH               260
+
+#define _CRT_WIDE_(s)           L ## s
+#define _CRT_WIDE(s)            _CRT_WIDE_(s)
+#define __FILEW__               _CRT_WIDE(__FILE__)
+
+union LARGE_INTEGER
+{
+    struct
+    {
+        DWORD LowPart;
+        LONG HighPart;
+    };
+    LONGLONG QuadPart;
+};
+
+union ULARGE_INTEGER
+{
+    struct
+    {
+        DWORD LowPart;
+        DWORD HighPart;
+    };
+    ULONGLONG QuadPart;
+};
+
+struct SYSTEM_INFO
+{
+    LPVOID lpMaximumApplicationAddress;
+    DWORD dwNumberOfProcessors;
+};
+
+inline void GetSystemInfo(SYSTEM_INFO* outSystemInfo)
+{
+    // x86-64 4ܰ ¡     ( 16Ʈ ׻ 0)
+    outSystemInfo->lpMaximumApplicationAddress = reinterpret_cast<LPVOID>(0x0000'7FFF'FFFF'EFFFULL);
+    outSystemInfo->dwNumberOfProcessors = static_cast<DWORD>(::sysconf(_SC_NPROCESSORS_ONLN));
+}
+
+inline void ZeroMemory(void* destination, size_t length) { ::memset(destination, 0, length); }
+
+#pragma endregion
+
+#pragma region Interlocked
+
+// MSVC Interlocked Լ  ǹ (seq_cst,    Ǵ   ȯ Ģ )
+
+template <typename T>
+inline T InterlockedIncrement(volatile T* target) { return __atomic_add_fetch(target, 1, __ATOMIC_SEQ_CST); }
+
+template <typename T>
+inline T InterlockedDecrement(volatile T* target) { return __atomic_sub_fetch(target, 1, __ATOMIC_SEQ_CST); }
+
+template <typename T>
+inline T InterlockedIncrement64(volatile T* target) { return __atomic_add_fetch(target, 1, __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedAdd(volatile T* target, V value) { return __atomic_add_fetch(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedAdd64(volatile T* target, V value) { return __atomic_add_fetch(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedExchangeAdd(volatile T* target, V value) { return __atomic_fetch_add(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedExchange(volatile T* target, V value) { return __atomic_exchange_n(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedExchange64(volatile T* target, V value) { return __atomic_exchange_n(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedExchange8(volatile T* target, V value) { return __atomic_exchange_n(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedAnd(volatile T* target, V value) { return __atomic_fetch_and(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V>
+inline T InterlockedOr(volatile T* target, V value) { return __atomic_fetch_or(target, static_cast<T>(value), __ATOMIC_SEQ_CST); }
+
+template <typename T, typename V1, typename V2>
+inline T InterlockedCompareExchange(volatile T* target, V1 exchange, V2 comparand)
+{
+    T expected = static_cast<T>(comparand);
+    __atomic_compare_exchange_n(target, &expected, static_cast<T>(exchange), false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return expected;
+}
+
+template <typename T, typename V1, typename V2>
+inline T InterlockedCompareExchange64(volatile T* target, V1 exchange, V2 comparand) { return InterlockedCompareExchange(target, exchange, comparand); }
+
+inline PVOID InterlockedCompareExchangePointer(PVOID volatile* target, PVOID exchange, PVOID comparand)
+{
+    PVOID expected = comparand;
+    __atomic_compare_exchange_n(target, &expected, exchange, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+    return expected;
+}
+
+inline PVOID InterlockedExchangePointer(PVOID volatile* target, PVOID value) { return __atomic_exchange_n(target, value, __ATOMIC_SEQ_CST); }
+
+#pragma endregion
+
+#pragma region SRWLOCK
+
+typedef pthread_rwlock_t SRWLOCK;
+
+inline void InitializeSRWLock(SRWLOCK* lock) { ::pthread_rwlock_init(lock, nullptr); }
+inline void AcquireSRWLockExclusive(SRWLOCK* lock) { ::pthread_rwlock_wrlock(lock); }
+inline void ReleaseSRWLockExclusive(SRWLOCK* lock) { ::pthread_rwlock_unlock(lock); }
+inline void AcquireSRWLockShared(SRWLOCK* lock) { ::pthread_rwlock_rdlock(lock); }
+inline void ReleaseSRWLockShared(SRWLOCK* lock) { ::pthread_rwlock_unlock(lock); }
+
+#pragma endregion
+
+#pragma region ð
+
+// timeGetTime()  ms  32Ʈ   ð
+inline DWORD timeGetTime(void)
+{
+    timespec now;
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+    return static_cast<DWORD>(static_cast<uint64_t>(now.tv_sec) * 1'000 + now.tv_nsec / 1'000'000);
+}
+
+inline DWORD timeBeginPeriod(DWORD) { return 0; }
+inline DWORD timeEndPeriod(DWORD) { return 0; }
+
+inline void Sleep(DWORD milliseconds)
+{
+    timespec duration;
+    duration.tv_sec = milliseconds / 1'000;
+    duration.tv_nsec = static_cast<long>(milliseconds % 1'000) * 1'000'000;
+    while (::nanosleep(&duration, &duration) == -1 && errno == EINTR) {}
+}
+
+inline BOOL QueryPerformanceCounter(LARGE_INTEGER* outCounter)
+{
+    timespec now;
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+    outCounter->QuadPart = static_cast<LONGLONG>(now.tv_sec) * 1'000'000'000 + now.tv_nsec;
+    return TRUE;
+}
+
+inline BOOL QueryPerformanceFrequency(LARGE_INTEGER* outFrequency)
+{
+    outFrequency->QuadPart = 1'000'000'000;
+    return TRUE;
+}
+
+inline errno_t localtime_s(tm* outTime, const time_t* source)
+{
+    return ::localtime_r(source, outTime) == nullptr ? errno : 0;
+}
+
+// FILETIME 迭 Windows  100ns  ä
+struct FILETIME
+{
+    DWORD dwLowDateTime;
+    DWORD dwHighDateTime;
+};
+
+typedef FILETIME* PFILETIME;
+typedef FILETIME* LPFILETIME;
+
+void GetSystemTimeAsFileTime(LPFILETIME outTime);
+
+// /proc/stat , Windows  Ŀ ð Idle ð Եȴ
+BOOL GetSystemTimes(PFILETIME outIdleTime, PFILETIME outKernelTime, PFILETIME outUserTime);
+
+// getrusage() ,  μ Ѵ
+HANDLE GetCurrentProcess(void);
+BOOL GetProcessTimes(HANDLE process, LPFILETIME outCreationTime, LPFILETIME outExitTime, LPFILETIME outKernelTime, LPFILETIME outUserTime);
+
+#pragma endregion
+
+#pragma region , ̺Ʈ,   Ÿ̸
+
+DWORD GetCurrentThreadId(void);
+DWORD GetCurrentProcessId(void);
+DWORD GetLastError(void);
+
+// _beginthreadex()   ڵ WaitForSingleObject() join, CloseHandle() 
+HANDLE _beginthreadex(void* security, unsigned stackSize, unsigned (*startAddress)(void*), void* argument, unsigned initFlag, unsigned* outThreadID);
+
+// ̺Ʈ (bManualReset = FALSE     ڵ ȣ ° ȴ)
+HANDLE CreateEvent(void* eventAttributes, BOOL bManualReset, BOOL bInitialState, const WCHAR* name);
+BOOL SetEvent(HANDLE event);
+BOOL ResetEvent(HANDLE event);
+
+//   Ÿ̸ (dueTime 100ns ,   ð)
+HANDLE CreateWaitableTimer(void* timerAttributes, BOOL bManualReset, const WCHAR* name);
+BOOL SetWaitableTimer(HANDLE timer, const LARGE_INTEGER* dueTime, LONG period, void* completionRoutine, void* argToCompletionRoutine, BOOL bResume);
+
+DWORD WaitForSingleObject(HANDLE handle, DWORD milliseconds);
+DWORD WaitForMultipleObjects(DWORD count, const HANDLE* handles, BOOL bWaitAll, DWORD milliseconds);
+BOOL CloseHandle(HANDLE handle);
+
+// ܼ Է (conio.h ü, ǥ Է б  ˻)
+int _kbhit(void);
+int _getch(void);
+
+#pragma endregion
+
+#pragma region CRT  Լ
+
+inline errno_t fopen_s(FILE** outFile, const char* fileName, const char* mode)
+{
+    *outFile = ::fopen(fileName, mode);
+    return *outFile == nullptr ? errno : 0;
+}
+
+// ̵ η  . UTF-16LE(BOM) ̶ wchar_t Ʈ ȯ ӽ  .
+errno_t _wfopen_s(FILE** outFile, const WCHAR* fileName, const WCHAR* mode);
+
+// ̵ ڿ UTF-8 ڿ ȯ
+std::string WideToUtf8(const WCHAR* source);
+
+template <size_t N>
+inline errno_t wcscpy_s(WCHAR(&dest)[N], const WCHAR* source)
+{
+    ::wcsncpy(dest, source, N - 1);
+    dest[N - 1] = L'\0';
+    return 0;
+}
+
+// MSVC sscanf_só ڿ ȯ(%s, %c, %[) ڵ  ũ  ȿ 
+//  ų ۺ ū ȯ  ũ⿡     ٲ㼭 sscanf ѱ (ڴ SCANF_S_MAX_ARG_COUNT)
+constexpr int SCANF_S_MAX_ARG_COUNT = 8;
+
+int sscanf_s(const char* buffer, const char* format, ...);
+int swscanf_s(const WCHAR* buffer, const WCHAR* format, ...);
+
+#define fprintf_s   fprintf
+#define fwprintf_s  fwprintf
+
+#pragma endregion
+
+#pragma region WinSock
+
+typedef sockaddr        SOCKADDR;
+typedef sockaddr_in     SOCKADDR_IN;
+typedef in_addr         IN_ADDR;
+typedef linger          LINGER;
+typedef addrinfo        ADDRINFOW;
+typedef pollfd          WSAPOLLFD;
+
+struct WSADATA {};
+
+struct WSABUF
+{
+    uint32_t len;
+    char* buf;
+};
+
+#define INVALID_SOCKET          (~static_cast<SOCKET>(0))
+#define SOCKET_ERROR            (-1)
+#define SD_RECEIVE              SHUT_RD
+#define SD_SEND                 SHUT_WR
+#define SD_BOTH                 SHUT_RDWR
+#define MAKEWORD(low, high)     (static_cast<WORD>((static_cast<BYTE>(low)) | (static_cast<WORD>(static_cast<BYTE>(high)) << 8)))
+
+#define WSAEINTR                EINTR
+#define WSAEINVAL               EINVAL
+#define WSAEWOULDBLOCK          EWOULDBLOCK
+#define WSAECONNRESET           ECONNRESET
+#define WSAECONNABORTED         ECONNABORTED
+#define WSAENOTSOCK             ENOTSOCK
+
+// Winsock   Ͽ  ۽ ñ׳ ƴ  ڵθ ޴´
+inline int WSAStartup(WORD, WSADATA*) { ::signal(SIGPIPE, SIG_IGN); return 0; }
+inline int WSACleanup(void) { return 0; }
+inline int WSAGetLastError(void) { return errno; }
+
+inline int closesocket(SOCKET socket) { return ::close(static_cast<int>(socket)); }
+
+inline int ioctlsocket(SOCKET socket, unsigned long command, u_long* argument)
+{
+    int value = static_cast<int>(*argument);
+    return ::ioctl(static_cast<int>(socket), command, &value);
+}
+
+inline int WSAPoll(WSAPOLLFD* fdArray, unsigned long fdCount, int timeout) { return ::poll(fdArray, fdCount, timeout); }
+
+inline int InetPtonW(int family, const WCHAR* source, void* dest)
+{
+    return ::inet_pton(family, WideToUtf8(source).c_str(), dest);
+}
+
+inline const WCHAR* InetNtopW(int family, const void* source, WCHAR* dest, size_t destLength)
+{
+    char narrow[INET6_ADDRSTRLEN];
+
+    if (::inet_ntop(family, source, narrow, sizeof(narrow)) == nullptr)
+    {
+        return nullptr;
+    }
+
+    ::swprintf(dest, destLength, L"%s", narrow);
+
+    return dest;
+}
+
+inline int GetAddrInfo(const WCHAR* nodeName, const WCHAR* serviceName, const ADDRINFOW* hints, ADDRINFOW** outResult)
+{
+    return ::getaddrinfo(WideToUtf8(nodeName).c_str(), WideToUtf8(serviceName).c_str(), hints, outResult);
+}
+
+inline void FreeAddrInfo(ADDRINFOW* addrInfo) { ::freeaddrinfo(addrInfo); }
+
+#pragma endregion
+
+#endif
@@ -2,7 +2,11 @@
 #include <cassert>
 #include <iostream>
 #include <cstring>
+#ifdef _WIN32
 #include <Windows.h>
+#else
+#include "../Platform/LinuxCompat.h"
+#endif
 
 #include <unordered_map>
 
@@ -1,6 +1,10 @@
 #pragma once
 
+#ifdef _WIN32
 #include <Windows.h>
+#else
+#include "../Platform/LinuxCompat.h"
+#endif
 
 #define MAX_THREAD_COUNT 200            // ִ  
 #define MAX_PROFILING_DATA_COUNT 50     // ִ ϸ ׸ 
@@ -2,6 +2,10 @@
 
 #include <iostream>
 
+#ifndef _WIN32
+#include "../Platform/LinuxCompat.h"
+#endif
+
 typedef wchar_t WCHAR;
 
 ////////////////////////////  ////////////////////////////
@@ -601,7 +605,7 @@ public:
             }
         }
 
-        swscanf_s(fileString + i + 1, L"%s", outString, outStringSize);
+        swscanf_s(fileString + i + 1, L"%ls", outString, outStringSize);
 
         fclose(fptr_configFile);
         delete[] fileString;
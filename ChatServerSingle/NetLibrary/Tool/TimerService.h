@@ -0,0 +1,248 @@
+#pragma once
+
+#include <cstdint>
+
+#include "../CrashDump/CrashDump.h"
+
+////////////////////////////////////////////////
+// Ÿ̸ ϳ - Ÿ̸Ӹ Ŵ ü(Player )   ִ´ (TimerService Ҵ )
+// ɷִ  ü ϱ  ݵ Cancel() ؾ Ѵ
+////////////////////////////////////////////////
+struct TimerNode
+{
+	TimerNode*	Prev = nullptr;
+	TimerNode*	Next = nullptr;		// ɷ ʴٸ nullptr
+	uint64_t	ExpireTick = 0;		//  ƽ (TimerService ƽ )
+	uint64_t	Key = 0;			//   ݹ Ѱִ  ( ID )
+
+	inline bool IsArmed(void) const { return Next != nullptr; }
+};
+
+////////////////////////////////////////////////
+//  Ÿ̹  - ɱ/ٽ ɱ/Ұ Ÿ̸   O(1)
+// 0ܰ  256ƽ  ĭ,  ܰ  Ʒ ܰ     ĭ 64ĭ  (ִ 2^26ƽ)
+//  ܰ ĭ Ÿ̸ӵ Ʒ ܰ      Ʒ ܰ ´
+//  忡 Ѵ ( )
+////////////////////////////////////////////////
+class TimerService
+{
+public:
+	TimerService(void) = default;
+
+	TimerService(const TimerService& other) = delete;
+	TimerService& operator=(const TimerService& other) = delete;
+
+	// currentTime(ms, timeGetTime() )  ð  , ƽ ϳ resolutionMs
+	void Init(const uint32_t currentTime, const uint32_t resolutionMs)
+	{
+		CrashDump::Assert(resolutionMs > 0);
+
+		mResolutionMs = resolutionMs;
+		mLastTime = currentTime;
+		mRemainMs = 0;
+		mCurrentTick = 0;
+
+		for (uint32_t i = 0; i < ROOT_WHEEL_SIZE; ++i)
+		{
+			initSlot(&mRootWheel[i]);
+		}
+
+		for (uint32_t level = 0; level < UPPER_WHEEL_COUNT; ++level)
+		{
+			for (uint32_t i = 0; i < UPPER_WHEEL_SIZE; ++i)
+			{
+				initSlot(&mUpperWheels[level][i]);
+			}
+		}
+	}
+
+	// delayMs ڿ ǵ Ǵ (̹ ɷִٸ ٽ Ǵ),  delayMs  ʰ ִ ƽ  ŭ   ִ ( ƽ  ð + ø)
+	inline void Arm(TimerNode* node, const uint32_t delayMs, const uint64_t key)
+	{
+		if (node->IsArmed())
+		{
+			unlink(node);
+		}
+
+		uint64_t delayTick = delayMs / mResolutionMs + 1;
+
+		if (delayTick >= MAX_DELAY_TICK)
+		{
+			delayTick = MAX_DELAY_TICK - 1;
+		}
+
+		node->ExpireTick = mCurrentTick + delayTick;
+		node->Key = key;
+
+		insert(node);
+	}
+
+	// ɷ ʴٸ ƹ͵  ʴ´
+	inline void Cancel(TimerNode* node)
+	{
+		if (node->IsArmed())
+		{
+			unlink(node);
+		}
+	}
+
+	// currentTime(ms) ð 긮鼭  Ÿ̸Ӹ onExpired(key) ȣϰ, ȣ Ƚ ȯѴ
+	// ݹ ȿ ٸ Ÿ̸Ӹ ɰų ص ȴ
+	template <typename Callback>
+	uint32_t Advance(const uint32_t currentTime, Callback&& onExpired)
+	{
+		// timeGetTime()   Ƶ ̴ ȴ
+		mRemainMs += currentTime - mLastTime;
+		mLastTime = currentTime;
+
+		uint32_t expiredCount = 0;
+
+		while (mRemainMs >= mResolutionMs)
+		{
+			mRemainMs -= mResolutionMs;
+
+			uint32_t rootIndex = static_cast<uint32_t>(mCurrentTick & (ROOT_WHEEL_SIZE - 1));
+
+			// 0ܰ    Ҵ -  ܰ  ĭ 
+			if (rootIndex == 0)
+			{
+				cascade();
+			}
+
+			// ĭ °  ڿ ϳ  (ݹ  ĭ ٽ ɾ ̹ ƽ ٽ  ʴ´)
+			TimerNode expiredList;
+			spliceSlot(&mRootWheel[rootIndex], &expiredList);
+
+			++mCurrentTick;
+
+			while (expiredList.Next != &expiredList)
+			{
+				TimerNode* node = expiredList.Next;
+				unlink(node);
+
+				++expiredCount;
+				onExpired(node->Key);
+			}
+		}
+
+		return expiredCount;
+	}
+
+private:
+
+	enum : uint32_t
+	{
+		ROOT_WHEEL_BITS = 8,
+		UPPER_WHEEL_BITS = 6,
+		UPPER_WHEEL_COUNT = 3,
+
+		ROOT_WHEEL_SIZE = 1 << ROOT_WHEEL_BITS,
+		UPPER_WHEEL_SIZE = 1 << UPPER_WHEEL_BITS,
+		MAX_DELAY_TICK = 1 << (ROOT_WHEEL_BITS + UPPER_WHEEL_BITS * UPPER_WHEEL_COUNT)
+	};
+
+	// ĭ ڱ ڽ Ű  Ʈ Ӹ 
+	static inline void initSlot(TimerNode* slot)
+	{
+		slot->Prev = slot;
+		slot->Next = slot;
+	}
+
+	static inline void unlink(TimerNode* node)
+	{
+		node->Prev->Next = node->Next;
+		node->Next->Prev = node->Prev;
+		node->Prev = nullptr;
+		node->Next = nullptr;
+	}
+
+	static inline void linkBack(TimerNode* slot, TimerNode* node)
+	{
+		node->Prev = slot->Prev;
+		node->Next = slot;
+		slot->Prev->Next = node;
+		slot->Prev = node;
+	}
+
+	// from ĭ  ִ to Ʈ ű
+	static inline void spliceSlot(TimerNode* from, TimerNode* to)
+	{
+		if (from->Next == from)
+		{
+			initSlot(to);
+			return;
+		}
+
+		to->Next = from->Next;
+		to->Prev = from->Prev;
+		to->Next->Prev = to;
+		to->Prev->Next = to;
+
+		initSlot(from);
+	}
+
+	//  ƽ  ܰ踦 ,  ƽ ش ܰ Ʈ ĭ 
+	inline void insert(TimerNode* node)
+	{
+		uint64_t expireTick = node->ExpireTick;
+
+		// ̹ ٸ  ƽ 
+		if (expireTick < mCurrentTick)
+		{
+			expireTick = mCurrentTick;
+		}
+
+		uint64_t remainTick = expireTick - mCurrentTick;
+
+		if (remainTick < ROOT_WHEEL_SIZE)
+		{
+			linkBack(&mRootWheel[expireTick & (ROOT_WHEEL_SIZE - 1)], node);
+			return;
+		}
+
+		for (uint32_t level = 0; level < UPPER_WHEEL_COUNT; ++level)
+		{
+			uint32_t shift = ROOT_WHEEL_BITS + UPPER_WHEEL_BITS * level;
+
+			if (remainTick < (1ULL << (shift + UPPER_WHEEL_BITS)) || level == UPPER_WHEEL_COUNT - 1)
+			{
+				linkBack(&mUpperWheels[level][(expireTick >> shift) & (UPPER_WHEEL_SIZE - 1)], node);
+				return;
+			}
+		}
+	}
+
+	//  ܰ ٵ  ĭ Ʒ ܰ ٽ ִ´ ( ܰ ĭ   Ҵٸ   ܰ赵)
+	inline void cascade(void)
+	{
+		for (uint32_t level = 0; level < UPPER_WHEEL_COUNT; ++level)
+		{
+			uint32_t shift = ROOT_WHEEL_BITS + UPPER_WHEEL_BITS * level;
+			uint32_t index = static_cast<uint32_t>((mCurrentTick >> shift) & (UPPER_WHEEL_SIZE - 1));
+
+			TimerNode cascadeList;
+			spliceSlot(&mUpperWheels[level][index], &cascadeList);
+
+			while (cascadeList.Next != &cascadeList)
+			{
+				TimerNode* node = cascadeList.Next;
+				unlink(node);
+				insert(node);
+			}
+
+			if (index != 0)
+			{
+				break;
+			}
+		}
+	}
+
+private:
+	TimerNode	mRootWheel[ROOT_WHEEL_SIZE];
+	TimerNode	mUpperWheels[UPPER_WHEEL_COUNT][UPPER_WHEEL_SIZE];
+
+	uint32_t	mResolutionMs = 1;
+	uint32_t	mLastTime = 0;		//  Advance()  ð
+	uint32_t	mRemainMs = 0;		// ƽ ϳ  ʾ 긮  ð
+	uint64_t	mCurrentTick = 0;	//  ó ƽ
+};
@@ -0,0 +1,282 @@
+////////////////////////////////////////////////
+// TimerService Ȯ - ɱ//ٽ ɱ,  ܰ ٿ  Ÿ̸(256ƽ, 16384ƽ ), timeGetTime()  
+//  Ÿ̸Ӵ   [delay, delay + ƽ 2] ȿ Ȯ   Ǿ Ѵ
+// Ʈ  ʴ ܵ  ,  Ȯ ִٸ 1 ȯѴ
+// Linux : g++ -std=c++17 -O2 -I../.. TimerServiceTest.cpp ../CrashDump/CrashDump.cpp ../Platform/LinuxCompat.cpp -o TimerServiceTest -lpthread
+////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cwchar>
+#include <vector>
+
+#include "TimerService.h"
+
+static int g_failCount = 0;
+
+#define CHECK(Condition) \
+    do { if (!(Condition)) { wprintf(L"FAIL %hs:%d %hs\n", __FILE__, __LINE__, #Condition); g_failCount++; } } while (0)
+
+// Ÿ̸ ϳ 밪 
+struct TimerRecord
+{
+    TimerNode Node;
+    uint32_t ArmTime = 0;
+    uint32_t DelayMs = 0;
+    uint32_t FireTime = 0;
+    uint32_t FireCount = 0;
+    bool bIsCancelled = false;
+};
+
+//  ð [delay, delay + ƽ 2]  (ð     Ƿ ̷ )
+static bool isInWindow(const TimerRecord& record, const uint32_t resolutionMs)
+{
+    uint32_t elapsed = record.FireTime - record.ArmTime;
+    return elapsed >= record.DelayMs && elapsed <= record.DelayMs + resolutionMs * 2;
+}
+
+// currentTime stepMs durationMsŭ 기,  Ÿ̸Ӵ key(ε) 
+static uint32_t advanceBy(TimerService& timers, std::vector<TimerRecord>& records, uint32_t& currentTime, const uint32_t durationMs, const uint32_t stepMs)
+{
+    uint32_t expiredCount = 0;
+
+    for (uint32_t elapsed = 0; elapsed < durationMs; elapsed += stepMs)
+    {
+        currentTime += stepMs;
+        expiredCount += timers.Advance(currentTime, [&records, &currentTime](const uint64_t key)
+            {
+                TimerRecord& record = records[key];
+                record.FireTime = currentTime;
+                record.FireCount++;
+            });
+    }
+
+    return expiredCount;
+}
+
+// ɱ, , ɷִ Ÿ̸Ӹ ٽ ɱ
+static void testArmAndCancel(void)
+{
+    const uint32_t resolutionMs = 10;
+    TimerService timers;
+    std::vector<TimerRecord> records(3);
+    uint32_t currentTime = 5000;
+
+    timers.Init(currentTime, resolutionMs);
+
+    for (uint32_t i = 0; i < records.size(); ++i)
+    {
+        records[i].ArmTime = currentTime;
+        records[i].DelayMs = 50;
+        timers.Arm(&records[i].Node, records[i].DelayMs, i);
+        CHECK(records[i].Node.IsArmed());
+    }
+
+    // 0 , 1  ʰ ٽ Ǵ
+    timers.Cancel(&records[0].Node);
+    CHECK(false == records[0].Node.IsArmed());
+    timers.Cancel(&records[0].Node);
+
+    advanceBy(timers, records, currentTime, 20, 1);
+    records[1].ArmTime = currentTime;
+    records[1].DelayMs = 200;
+    timers.Arm(&records[1].Node, records[1].DelayMs, 1);
+
+    advanceBy(timers, records, currentTime, 300, 1);
+
+    CHECK(records[0].FireCount == 0);
+    CHECK(records[1].FireCount == 1);
+    CHECK(records[2].FireCount == 1);
+    CHECK(isInWindow(records[1], resolutionMs));
+    CHECK(isInWindow(records[2], resolutionMs));
+
+    for (const TimerRecord& record : records)
+    {
+        CHECK(false == record.Node.IsArmed());
+    }
+
+    //  ڿ ص ƹ  
+    timers.Cancel(&records[2].Node);
+    CHECK(timers.Advance(currentTime + 1000, [](const uint64_t) {}) == 0);
+}
+
+// 0ܰ  (256ƽ) 1ܰ  (16384ƽ) Ѵ Ÿ̸Ӱ  ܰ迡  
+static void testCascade(void)
+{
+    const uint32_t resolutionMs = 1;
+    const uint32_t delays[] = { 0, 1, 254, 255, 256, 257, 300, 511, 512, 16383, 16384, 16385, 20000, 70000 };
+    const uint32_t delayCount = sizeof(delays) / sizeof(delays[0]);
+
+    //  ƽ ٲ㰡 Ǵ -  ٷ /ڿ  Ÿ̸ӵ Ȯ
+    for (uint32_t startTick : { 0u, 1u, 255u, 256u, 16383u, 16384u })
+    {
+        TimerService timers;
+        std::vector<TimerRecord> records(delayCount);
+        uint32_t currentTime = 0;
+
+        timers.Init(currentTime, resolutionMs);
+        advanceBy(timers, records, currentTime, startTick, 1);
+
+        for (uint32_t i = 0; i < delayCount; ++i)
+        {
+            records[i].ArmTime = currentTime;
+            records[i].DelayMs = delays[i];
+            timers.Arm(&records[i].Node, delays[i], i);
+        }
+
+        uint32_t expiredCount = advanceBy(timers, records, currentTime, 70000 + 10, 1);
+        CHECK(expiredCount == delayCount);
+
+        for (const TimerRecord& record : records)
+        {
+            CHECK(record.FireCount == 1);
+            CHECK(isInWindow(record, resolutionMs));
+        }
+    }
+}
+
+//  ݹ ȿ  Ÿ̸Ӹ ٽ Ǵ ( ƽ ٽ  ʾƾ Ѵ)
+static void testRearmFromCallback(void)
+{
+    const uint32_t resolutionMs = 5;
+    TimerService timers;
+    TimerNode node;
+    std::vector<uint32_t> fireTimes;
+    uint32_t currentTime = 100;
+
+    timers.Init(currentTime, resolutionMs);
+    timers.Arm(&node, 0, 0);
+
+    for (uint32_t elapsed = 0; elapsed < 1000; ++elapsed)
+    {
+        ++currentTime;
+        timers.Advance(currentTime, [&](const uint64_t key)
+            {
+                fireTimes.push_back(currentTime);
+
+                if (fireTimes.size() < 5)
+                {
+                    timers.Arm(&node, 40, key);
+                }
+            });
+    }
+
+    CHECK(fireTimes.size() == 5);
+    CHECK(false == node.IsArmed());
+
+    for (size_t i = 1; i < fireTimes.size(); ++i)
+    {
+        uint32_t interval = fireTimes[i] - fireTimes[i - 1];
+        CHECK(interval >= 40 && interval <= 40 + resolutionMs * 2);
+    }
+}
+
+//  Ÿ̸Ӹ  ɰ Ϻθ ϸ鼭 기 - ƽ  /ū  Advance()
+static void testManyTimers(void)
+{
+    for (uint32_t stepMs : { 1u, 3u, 37u })
+    {
+        const uint32_t resolutionMs = 4;
+        TimerService timers;
+        std::vector<TimerRecord> records(3000);
+        uint32_t currentTime = 77;
+        uint32_t randomState = 0x9E37'79B9;
+
+        auto nextRandom = [&randomState](const uint32_t range)
+            {
+                randomState ^= randomState << 13;
+                randomState ^= randomState >> 17;
+                randomState ^= randomState << 5;
+                return randomState % range;
+            };
+
+        timers.Init(currentTime, resolutionMs);
+
+        for (uint32_t i = 0; i < records.size(); ++i)
+        {
+            records[i].ArmTime = currentTime;
+            records[i].DelayMs = nextRandom(100'000);
+            timers.Arm(&records[i].Node, records[i].DelayMs, i);
+
+            //  Ÿ̸  ϳ  ϰų ٽ Ǵ
+            TimerRecord& other = records[nextRandom(i + 1)];
+            if (other.FireCount == 0 && nextRandom(8) == 0)
+            {
+                if (nextRandom(2) == 0)
+                {
+                    timers.Cancel(&other.Node);
+                    other.bIsCancelled = true;
+                }
+                else
+                {
+                    other.ArmTime = currentTime;
+                    other.DelayMs = nextRandom(100'000);
+                    other.bIsCancelled = false;
+                    timers.Arm(&other.Node, other.DelayMs, static_cast<uint64_t>(&other - records.data()));
+                }
+            }
+
+            advanceBy(timers, records, currentTime, stepMs * (1 + nextRandom(4)), stepMs);
+        }
+
+        advanceBy(timers, records, currentTime, 110'000, stepMs);
+
+        for (const TimerRecord& record : records)
+        {
+            if (record.bIsCancelled)
+            {
+                CHECK(record.FireCount == 0);
+                continue;
+            }
+
+            CHECK(record.FireCount == 1);
+
+            //   stepMs 긮Ƿ ׸ŭ ʰ   ִ
+            uint32_t elapsed = record.FireTime - record.ArmTime;
+            CHECK(elapsed >= record.DelayMs && elapsed <= record.DelayMs + resolutionMs * 2 + stepMs);
+        }
+    }
+}
+
+// timeGetTime() 0xFFFFFFFF Ѿ 0 ư 帧  ʴ
+static void testTimeWraparound(void)
+{
+    const uint32_t resolutionMs = 10;
+    TimerService timers;
+    std::vector<TimerRecord> records(4);
+    uint32_t currentTime = 0xFFFF'FF00;
+
+    timers.Init(currentTime, resolutionMs);
+
+    const uint32_t delays[] = { 100, 256, 1000, 5000 };
+    for (uint32_t i = 0; i < records.size(); ++i)
+    {
+        records[i].ArmTime = currentTime;
+        records[i].DelayMs = delays[i];
+        timers.Arm(&records[i].Node, delays[i], i);
+    }
+
+    uint32_t expiredCount = advanceBy(timers, records, currentTime, 6000, 7);
+    CHECK(expiredCount == records.size());
+    CHECK(currentTime < 0x1'0000);
+
+    for (const TimerRecord& record : records)
+    {
+        CHECK(record.FireCount == 1);
+
+        // 7ms 긮Ƿ ׸ŭ ʰ   ִ
+        uint32_t elapsed = record.FireTime - record.ArmTime;
+        CHECK(elapsed >= record.DelayMs && elapsed <= record.DelayMs + resolutionMs * 2 + 7);
+    }
+}
+
+int main(void)
+{
+    testArmAndCancel();
+    testCascade();
+    testRearmFromCallback();
+    testManyTimers();
+    testTimeWraparound();
+
+    wprintf(L"TimerServiceTest : %ls\n", g_failCount == 0 ? L"OK" : L"FAILED");
+    return g_failCount == 0 ? 0 : 1;
+}
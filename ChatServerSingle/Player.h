@@ -2,7 +2,8 @@
 
 #include <cstdint>
 
-typedef wchar_t WCHAR;
+#include "Protocol.h"
+#include "NetLibrary/Tool/TimerService.h"
 
 struct Player
 {
@@ -12,12 +13,12 @@ public:
     Player() = default;
 #pragma warning(pop)
 
-    void Init(const uint64_t sessionID)
+    void Init(const uint64_t sessionID, const uint32_t currentTick)
     {
         mSessionID = sessionID;
         mbLoggedIn = false;
         mbSectorIn = false;
-        mLastRecvTick = ::timeGetTime();
+        mLastRecvTick = currentTick;
     }
 
     inline bool         IsLoggedIn(void) const { return mbLoggedIn; }
@@ -26,21 +27,24 @@ public:
     inline uint16_t     GetSectorX(void) const { return mSectorX; }
     inline uint16_t     GetSectorY(void) const { return mSectorY; }
     inline int64_t      GetAccountNo(void) const { return mAccountNo; }
-    inline const WCHAR* GetID(void) const { return mID; }
-    inline const WCHAR* GetNickName(void) const { return mNickName; }
+    inline const WCHAR16* GetID(void) const { return mID; }
+    inline const WCHAR16* GetNickName(void) const { return mNickName; }
     inline const char*  GetSessionKey(void) const { return mSessionKey; }
 
     inline uint64_t     GetSessionID(void) const { return mSessionID; }
     inline uint32_t     GetLastRecvTick(void) const { return mLastRecvTick; }
 
-    inline void         UpdateLastRecvTick(void) { mLastRecvTick = ::timeGetTime(); }
+    inline void         UpdateLastRecvTick(const uint32_t currentTick) { mLastRecvTick = currentTick; }
 
-    void LogIn(const int64_t accountNo, const WCHAR id[], const WCHAR nickName[], const char sessionKey[])
+    // ŸӾƿ Ÿ̸ (ChatServer TimerService ɸ)
+    inline TimerNode*   GetTimeoutTimer(void) { return &mTimeoutTimer; }
+
+    void LogIn(const int64_t accountNo, const WCHAR16 id[], const WCHAR16 nickName[], const char sessionKey[])
     {
         mbLoggedIn = true;
         mAccountNo = accountNo;
-        memcpy(&mID, id, sizeof(WCHAR) * 20);
-        memcpy(&mNickName, nickName, sizeof(WCHAR) * 20);
+        memcpy(&mID, id, sizeof(WCHAR16) * 20);
+        memcpy(&mNickName, nickName, sizeof(WCHAR16) * 20);
         memcpy(&mSessionKey, sessionKey, sizeof(char) * 64);
     }
 
@@ -59,7 +63,8 @@ private:
     uint16_t    mSectorX;
     uint16_t    mSectorY;
     int64_t     mAccountNo;
-    WCHAR       mID[20];
-    WCHAR       mNickName[20];
+    WCHAR16     mID[20];
+    WCHAR16     mNickName[20];
     char        mSessionKey[64];
+    TimerNode   mTimeoutTimer;
 };
\ No newline at end of file
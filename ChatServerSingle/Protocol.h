@@ -1,5 +1,10 @@
 #pragma once
 
+//  WCHAR UTF-16 (2Ʈ), Linux wchar_t 4Ʈ̹Ƿ  Ÿ Ѵ
+typedef char16_t WCHAR16;
+
+// Ʒ ּ ޼ ġ ProtocolSchema.txt ̴ - ٲ  Ű ġ ProtocolGen.py ProtocolMessage.h ٽ 
+
 enum en_PACKET_TYPE
 {
 	////////////////////////////////////////////////////////
@@ -34,7 +39,7 @@ enum en_PACKET_TYPE
 	//	{
 	//		WORD	Type
 	//
-	//		BYTE	Status				// 0:	1:
+	//		BYTE	Status				// 0:	1:	2:  (  õ) - ϴ Define
 	//		INT64	AccountNo
 	//	}
 	//
@@ -248,6 +253,14 @@ enum en_PACKET_SS_MONITOR_DATA_UPDATE
 };
 
 
+enum en_PACKET_CS_CHAT_RES_LOGIN
+{
+	dfCHAT_LOGIN_FAIL = 0,		// α 
+	dfCHAT_LOGIN_OK = 1,		// α 
+	dfCHAT_LOGIN_ERR_OVERLOAD = 2,		//  Ϸ α  (ᵵ )
+};
+
+
 enum en_PACKET_CS_MONITOR_TOOL_RES_LOGIN
 {
 	dfMONITOR_TOOL_LOGIN_OK = 1,		// α 
@@ -0,0 +1,337 @@
+# 프로토콜 코드 생성기 - ProtocolSchema.txt를 읽어서 ProtocolMessage.h를 만든다
+#
+# 사용법: python ProtocolGen.py [스키마 파일] [출력 파일]
+#         (인자가 없다면 이 스크립트 옆의 ProtocolSchema.txt -> ProtocolMessage.h)
+#
+# 소스와 같이 CP949로 읽고 쓴다
+
+import os
+import re
+import sys
+
+ENCODING = 'cp949'
+
+# 스키마 타입 -> (C++ 타입, 바이트 크기)
+FIELD_TYPES = {
+    'BYTE':  ('uint8_t', 1),
+    'WORD':  ('uint16_t', 2),
+    'int':   ('int32_t', 4),
+    'INT64': ('int64_t', 8),
+    'char':  ('char', 1),
+    'WCHAR': ('WCHAR16', 2),
+}
+
+MESSAGE_LINE = re.compile(r'^message\s+(\w+)(?:\s+handler\s+(\w+))?$')
+FIELD_LINE = re.compile(r'^(\w+)\s+(\w+)(?:\[(\d+)\])?$')
+TAIL_LINE = re.compile(r'^tail\s+(\w+)\s+(\w+)$')
+
+
+class SchemaError(Exception):
+    def __init__(self, path, lineNumber, text):
+        super().__init__('%s(%d): %s' % (path, lineNumber, text))
+
+
+class Field:
+    def __init__(self, typeName, name, count, comment):
+        self.TypeName = typeName
+        self.Name = name
+        self.Count = count          # 배열이 아니라면 None
+        self.Comment = comment
+
+    @property
+    def CppType(self):
+        return FIELD_TYPES[self.TypeName][0]
+
+    @property
+    def Size(self):
+        return FIELD_TYPES[self.TypeName][1] * (self.Count or 1)
+
+
+class Message:
+    def __init__(self, name, handler, comments):
+        self.Name = name
+        self.Handler = handler
+        self.Comments = comments
+        self.Fields = []
+        self.Tail = None            # (필드 이름, 길이 필드 이름, 주석)
+
+    @property
+    def BodySize(self):
+        return sum(field.Size for field in self.Fields)
+
+
+def splitComment(line):
+    if '//' in line:
+        code, comment = line.split('//', 1)
+        return code.strip(), comment.strip()
+    return line.strip(), None
+
+
+def parseSchema(path):
+    messages = []
+    comments = []
+    current = None
+
+    with open(path, encoding=ENCODING) as schemaFile:
+        for lineNumber, rawLine in enumerate(schemaFile, 1):
+            line = rawLine.strip()
+
+            if current is None:
+                if line == '':
+                    comments = []
+                    continue
+
+                if line.startswith('#'):
+                    comments.append(line[1:].strip())
+                    continue
+
+                match = MESSAGE_LINE.match(line)
+                if match is None:
+                    raise SchemaError(path, lineNumber, 'message 줄이 와야 한다: ' + line)
+
+                name, handler = match.groups()
+                if any(message.Name == name for message in messages):
+                    raise SchemaError(path, lineNumber, '같은 이름의 메세지가 있다: ' + name)
+
+                current = Message(name, handler, comments)
+                comments = []
+                continue
+
+            code, comment = splitComment(line)
+
+            if code == '':
+                continue
+
+            if code == 'end':
+                messages.append(current)
+                current = None
+                continue
+
+            if current.Tail is not None:
+                raise SchemaError(path, lineNumber, 'tail은 마지막 필드여야 한다')
+
+            match = TAIL_LINE.match(code)
+            if match is not None:
+                tailName, lengthName = match.groups()
+                lengthField = next((field for field in current.Fields if field.Name == lengthName), None)
+
+                if lengthField is None or lengthField.Count is not None or lengthField.TypeName not in ('BYTE', 'WORD', 'int'):
+                    raise SchemaError(path, lineNumber, 'tail의 길이 필드는 앞에 있는 정수 필드여야 한다: ' + lengthName)
+
+                current.Tail = (tailName, lengthName, comment)
+                continue
+
+            match = FIELD_LINE.match(code)
+            if match is None:
+                raise SchemaError(path, lineNumber, '필드를 읽을 수 없다: ' + code)
+
+            typeName, name, count = match.groups()
+            if typeName not in FIELD_TYPES:
+                raise SchemaError(path, lineNumber, '모르는 타입: ' + typeName)
+
+            if any(field.Name == name for field in current.Fields):
+                raise SchemaError(path, lineNumber, '같은 이름의 필드가 있다: ' + name)
+
+            current.Fields.append(Field(typeName, name, int(count) if count else None, comment))
+
+    if current is not None:
+        raise SchemaError(path, lineNumber, current.Name + '에 end가 없다')
+
+    return messages
+
+
+def writeComments(out, comments, indent=''):
+    for comment in comments:
+        out.append(indent + '// ' + comment if comment else indent + '//')
+
+
+def generateStruct(out, message):
+    writeComments(out, message.Comments)
+    out.append('struct %s' % message.Name)
+    out.append('{')
+
+    for field in message.Fields:
+        declaration = '    %-12s%s%s;' % (field.CppType, field.Name, '[%d]' % field.Count if field.Count else '')
+        out.append('%-36s// %s' % (declaration, field.Comment) if field.Comment else declaration)
+
+    if message.Tail is not None:
+        tailName, lengthName, comment = message.Tail
+        if message.Fields:
+            out.append('')
+        out.append('    // 뒤에 %s가 %s 바이트 붙는다%s' % (tailName, lengthName, ' - ' + comment if comment else ''))
+        out.append('    inline uint32_t GetTailSize(void) const { return %s; }' % lengthName)
+
+    out.append('};')
+    out.append('')
+
+
+def generateTraits(out, message):
+    sizes = ' + '.join(str(field.Size) for field in message.Fields) or '0'
+
+    out.append('template <> inline constexpr uint16_t PACKET_TYPE<%s> = en_PACKET_%s;' % (message.Name, message.Name))
+    out.append('static_assert(PACKET_BODY_SIZE<%s> == %s);' % (message.Name, sizes))
+
+
+def generateEncoder(out, message):
+    parameters = []
+    for field in message.Fields:
+        if field.Count:
+            parameters.append('const %s %s[%d]' % (field.CppType, field.Name, field.Count))
+        else:
+            parameters.append('const %s %s' % (field.CppType, field.Name))
+
+    if message.Tail is not None:
+        parameters.append('Serializer* %s' % message.Tail[0])
+
+    writeComments(out, message.Comments)
+    if message.Tail is not None:
+        out.append('// %s는 현재 위치부터 %s 바이트가 남아 있어야 한다 (받은 패킷의 본문을 그대로 옮긴다)' % message.Tail[:2])
+    out.append('inline Serializer* Encode_%s(%s)' % (message.Name, ', '.join(parameters) or 'void'))
+    out.append('{')
+
+    if not message.Fields:
+        out.append('    const uint16_t type = PACKET_TYPE<%s>;' % message.Name)
+        out.append('')
+        out.append('    Serializer* packet = Serializer::Alloc(sizeof(type));')
+        out.append('    packet->InsertByte(reinterpret_cast<const char*>(&type), sizeof(type));')
+    else:
+        out.append('    PacketWire<%s> wire;' % message.Name)
+        out.append('    wire.Type = PACKET_TYPE<%s>;' % message.Name)
+
+        for field in message.Fields:
+            if field.Count:
+                out.append('    ::memcpy(wire.Body.%s, %s, sizeof(wire.Body.%s));' % (field.Name, field.Name, field.Name))
+            else:
+                out.append('    wire.Body.%s = %s;' % (field.Name, field.Name))
+
+        sizeHint = 'sizeof(wire)' if message.Tail is None else 'sizeof(wire) + %s' % message.Tail[1]
+
+        out.append('')
+        out.append('    Serializer* packet = Serializer::Alloc(%s);' % sizeHint)
+        out.append('    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));')
+
+        if message.Tail is not None:
+            out.append('    %s->GetByte(packet, %s);' % message.Tail[:2])
+
+    out.append('')
+    out.append('    return packet;')
+    out.append('}')
+    out.append('')
+
+
+def generateHandlers(out, handler, messages):
+    out.append('// %s가 받는 메세지 - FIXED(메세지) / VARIABLE(메세지)로 펼쳐서 디스패치 테이블을 만든다' % handler)
+    out.append('#define %s_PACKET_HANDLERS(FIXED, VARIABLE) \\' % handler)
+
+    for index, message in enumerate(messages):
+        suffix = ' \\' if index + 1 < len(messages) else ''
+        out.append('    %s(%s)%s' % ('VARIABLE' if message.Tail else 'FIXED', message.Name, suffix))
+
+    out.append('')
+    out.append('// %s가 받는 메세지 타입의 끝 (이 값 이상의 타입은 받지 않는다)' % handler)
+    out.append('inline constexpr uint32_t %s_PACKET_TYPE_END = (std::max)({ %s }) + 1u;'
+               % (handler, ', '.join('PACKET_TYPE<%s>' % message.Name for message in messages)))
+    out.append('')
+
+
+def generate(messages, schemaName):
+    out = []
+    out.append('#pragma once')
+    out.append('')
+    out.append('////////////////////////////////////////////////')
+    out.append('// 자동 생성 파일 - %s를 고치고 python ProtocolGen.py로 다시 만든다 (직접 고치지 않는다)' % schemaName)
+    out.append('//')
+    out.append('// 메세지마다')
+    out.append('//  - 본문 구조체 (Type 다음부터, Protocol.h의 바이트 배치 그대로), PACKET_TYPE, PACKET_BODY_SIZE')
+    out.append('//  - Encode_<메세지>() : Type과 고정 길이 본문을 스택에서 채워서 한 번에 써 넣는다 (범위 검사 한 번, 복사 한 번)')
+    out.append('// 받는 쪽마다 <받는 쪽>_PACKET_HANDLERS(FIXED, VARIABLE) 목록')
+    out.append('//')
+    out.append('// 고정 길이 메세지는 본문 크기가 PACKET_BODY_SIZE와 같아야 하고,')
+    out.append('// 가변 길이 메세지는 PACKET_BODY_SIZE가 최소 크기이며 뒤에 GetTailSize() 바이트가 붙는다')
+    out.append('////////////////////////////////////////////////')
+    out.append('')
+    out.append('#include <algorithm>')
+    out.append('#include <cstdint>')
+    out.append('#include <cstring>')
+    out.append('#include <type_traits>')
+    out.append('')
+    out.append('#include "Protocol.h"')
+    out.append('#include "NetLibrary/NetServer/Serializer.h"')
+    out.append('')
+    out.append('// 메세지 구조체의 en_PACKET_TYPE (스키마에 있는 메세지만 특수화된다)')
+    out.append('template <typename Message>')
+    out.append('inline constexpr uint16_t PACKET_TYPE = 0;')
+    out.append('')
+    out.append('// 빈 구조체의 sizeof는 1이므로 본문 크기는 이것으로 구한다')
+    out.append('template <typename Message>')
+    out.append('inline constexpr uint32_t PACKET_BODY_SIZE = std::is_empty_v<Message> ? 0 : static_cast<uint32_t>(sizeof(Message));')
+    out.append('')
+    out.append('#pragma pack (push,1)')
+    out.append('')
+    out.append('// 보낼 때 Type과 본문을 이어 붙인 배치')
+    out.append('template <typename Message>')
+    out.append('struct PacketWire')
+    out.append('{')
+    out.append('    uint16_t    Type;')
+    out.append('    Message     Body;')
+    out.append('};')
+    out.append('')
+
+    for message in messages:
+        generateStruct(out, message)
+
+    out.append('#pragma pack (pop)')
+    out.append('')
+
+    for message in messages:
+        generateTraits(out, message)
+
+    out.append('')
+    out.append('////////////////////////////////////////////////')
+    out.append('// 인코더 - 참조 카운트 1인 패킷을 돌려준다 (보낸 뒤 Serializer::Free() 필요)')
+    out.append('////////////////////////////////////////////////')
+    out.append('')
+
+    for message in messages:
+        generateEncoder(out, message)
+
+    handlers = []
+    for message in messages:
+        if message.Handler and message.Handler not in handlers:
+            handlers.append(message.Handler)
+
+    if handlers:
+        out.append('////////////////////////////////////////////////')
+        out.append('// 디스패치 목록')
+        out.append('////////////////////////////////////////////////')
+        out.append('')
+
+        for handler in handlers:
+            generateHandlers(out, handler, [message for message in messages if message.Handler == handler])
+
+    while out[-1] == '':
+        out.pop()
+
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    baseDirectory = os.path.dirname(os.path.abspath(__file__))
+    schemaPath = sys.argv[1] if len(sys.argv) > 1 else os.path.join(baseDirectory, 'ProtocolSchema.txt')
+    outputPath = sys.argv[2] if len(sys.argv) > 2 else os.path.join(baseDirectory, 'ProtocolMessage.h')
+
+    try:
+        messages = parseSchema(schemaPath)
+    except SchemaError as error:
+        print(error, file=sys.stderr)
+        return 1
+
+    with open(outputPath, 'w', encoding=ENCODING, newline='\n') as outputFile:
+        outputFile.write(generate(messages, os.path.basename(schemaPath)))
+
+    print('%s -> %s (%d messages)' % (os.path.basename(schemaPath), os.path.basename(outputPath), len(messages)))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,353 @@
+#pragma once
+
+////////////////////////////////////////////////
+// ڵ   - ProtocolSchema.txt ġ python ProtocolGen.py ٽ  ( ġ ʴ´)
+//
+// ޼
+//  -  ü (Type , Protocol.h Ʈ ġ ״), PACKET_TYPE, PACKET_BODY_SIZE
+//  - Encode_<޼>() : Type    ÿ ä    ִ´ ( ˻  ,   )
+// ޴ ʸ <޴ >_PACKET_HANDLERS(FIXED, VARIABLE) 
+//
+//   ޼  ũⰡ PACKET_BODY_SIZE ƾ ϰ,
+//   ޼ PACKET_BODY_SIZE ּ ũ̸ ڿ GetTailSize() Ʈ ٴ´
+////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "Protocol.h"
+#include "NetLibrary/NetServer/Serializer.h"
+
+// ޼ ü en_PACKET_TYPE (Ű ִ ޼ Ưȭȴ)
+template <typename Message>
+inline constexpr uint16_t PACKET_TYPE = 0;
+
+//  ü sizeof 1̹Ƿ  ũ ̰ Ѵ
+template <typename Message>
+inline constexpr uint32_t PACKET_BODY_SIZE = std::is_empty_v<Message> ? 0 : static_cast<uint32_t>(sizeof(Message));
+
+#pragma pack (push,1)
+
+//   Type  ̾  ġ
+template <typename Message>
+struct PacketWire
+{
+    uint16_t    Type;
+    Message     Body;
+};
+
+// äü α û
+struct CS_CHAT_REQ_LOGIN
+{
+    int64_t     AccountNo;
+    WCHAR16     ID[20];             // null 
+    WCHAR16     Nickname[20];       // null 
+    char        SessionKey[64];
+};
+
+// äü α 
+struct CS_CHAT_RES_LOGIN
+{
+    uint8_t     Status;             // 0: 1: 2:  (en_PACKET_CS_CHAT_RES_LOGIN)
+    int64_t     AccountNo;
+};
+
+// äü  ̵ û
+struct CS_CHAT_REQ_SECTOR_MOVE
+{
+    int64_t     AccountNo;
+    uint16_t    SectorX;
+    uint16_t    SectorY;
+};
+
+// äü  ̵ 
+struct CS_CHAT_RES_SECTOR_MOVE
+{
+    int64_t     AccountNo;
+    uint16_t    SectorX;
+    uint16_t    SectorY;
+};
+
+// äü äú û
+struct CS_CHAT_REQ_MESSAGE
+{
+    int64_t     AccountNo;
+    uint16_t    MessageLen;
+
+    // ڿ Message MessageLen Ʈ ٴ´ - WCHAR Message[MessageLen / 2], null 
+    inline uint32_t GetTailSize(void) const { return MessageLen; }
+};
+
+// äü äú  (ٸ Ŭ  äõ ̰ɷ )
+struct CS_CHAT_RES_MESSAGE
+{
+    int64_t     AccountNo;
+    WCHAR16     ID[20];             // null 
+    WCHAR16     Nickname[20];       // null 
+    uint16_t    MessageLen;
+
+    // ڿ Message MessageLen Ʈ ٴ´ - WCHAR Message[MessageLen / 2], null 
+    inline uint32_t GetTailSize(void) const { return MessageLen; }
+};
+
+// ƮƮ -  
+struct CS_CHAT_REQ_HEARTBEAT
+{
+};
+
+//  ͸  α
+struct SS_MONITOR_LOGIN
+{
+    int32_t     ServerNo;           //    ȣ
+};
+
+//  ͸    (1ʸ)
+struct SS_MONITOR_DATA_UPDATE
+{
+    uint8_t     DataType;           // en_PACKET_SS_MONITOR_DATA_UPDATE
+    int32_t     DataValue;
+    int32_t     TimeStamp;          // time() int ĳ
+};
+
+// ͸  ͸  α û
+struct CS_MONITOR_TOOL_REQ_LOGIN
+{
+    char        LoginSessionKey[32];
+};
+
+// ͸  α 
+struct CS_MONITOR_TOOL_RES_LOGIN
+{
+    uint8_t     Status;             // en_PACKET_CS_MONITOR_TOOL_RES_LOGIN
+};
+
+// ͸  ͸   
+struct CS_MONITOR_TOOL_DATA_UPDATE
+{
+    uint8_t     ServerNo;
+    uint8_t     DataType;           // en_PACKET_SS_MONITOR_DATA_UPDATE
+    int32_t     DataValue;
+    int32_t     TimeStamp;          // time() int ĳ
+};
+
+#pragma pack (pop)
+
+template <> inline constexpr uint16_t PACKET_TYPE<CS_CHAT_REQ_LOGIN> = en_PACKET_CS_CHAT_REQ_LOGIN;
+static_assert(PACKET_BODY_SIZE<CS_CHAT_REQ_LOGIN> == 8 + 40 + 40 + 64);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_CHAT_RES_LOGIN> = en_PACKET_CS_CHAT_RES_LOGIN;
+static_assert(PACKET_BODY_SIZE<CS_CHAT_RES_LOGIN> == 1 + 8);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_CHAT_REQ_SECTOR_MOVE> = en_PACKET_CS_CHAT_REQ_SECTOR_MOVE;
+static_assert(PACKET_BODY_SIZE<CS_CHAT_REQ_SECTOR_MOVE> == 8 + 2 + 2);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_CHAT_RES_SECTOR_MOVE> = en_PACKET_CS_CHAT_RES_SECTOR_MOVE;
+static_assert(PACKET_BODY_SIZE<CS_CHAT_RES_SECTOR_MOVE> == 8 + 2 + 2);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_CHAT_REQ_MESSAGE> = en_PACKET_CS_CHAT_REQ_MESSAGE;
+static_assert(PACKET_BODY_SIZE<CS_CHAT_REQ_MESSAGE> == 8 + 2);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_CHAT_RES_MESSAGE> = en_PACKET_CS_CHAT_RES_MESSAGE;
+static_assert(PACKET_BODY_SIZE<CS_CHAT_RES_MESSAGE> == 8 + 40 + 40 + 2);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_CHAT_REQ_HEARTBEAT> = en_PACKET_CS_CHAT_REQ_HEARTBEAT;
+static_assert(PACKET_BODY_SIZE<CS_CHAT_REQ_HEARTBEAT> == 0);
+template <> inline constexpr uint16_t PACKET_TYPE<SS_MONITOR_LOGIN> = en_PACKET_SS_MONITOR_LOGIN;
+static_assert(PACKET_BODY_SIZE<SS_MONITOR_LOGIN> == 4);
+template <> inline constexpr uint16_t PACKET_TYPE<SS_MONITOR_DATA_UPDATE> = en_PACKET_SS_MONITOR_DATA_UPDATE;
+static_assert(PACKET_BODY_SIZE<SS_MONITOR_DATA_UPDATE> == 1 + 4 + 4);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_MONITOR_TOOL_REQ_LOGIN> = en_PACKET_CS_MONITOR_TOOL_REQ_LOGIN;
+static_assert(PACKET_BODY_SIZE<CS_MONITOR_TOOL_REQ_LOGIN> == 32);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_MONITOR_TOOL_RES_LOGIN> = en_PACKET_CS_MONITOR_TOOL_RES_LOGIN;
+static_assert(PACKET_BODY_SIZE<CS_MONITOR_TOOL_RES_LOGIN> == 1);
+template <> inline constexpr uint16_t PACKET_TYPE<CS_MONITOR_TOOL_DATA_UPDATE> = en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE;
+static_assert(PACKET_BODY_SIZE<CS_MONITOR_TOOL_DATA_UPDATE> == 1 + 1 + 4 + 4);
+
+////////////////////////////////////////////////
+// ڴ -  īƮ 1 Ŷ ش (  Serializer::Free() ʿ)
+////////////////////////////////////////////////
+
+// äü α û
+inline Serializer* Encode_CS_CHAT_REQ_LOGIN(const int64_t AccountNo, const WCHAR16 ID[20], const WCHAR16 Nickname[20], const char SessionKey[64])
+{
+    PacketWire<CS_CHAT_REQ_LOGIN> wire;
+    wire.Type = PACKET_TYPE<CS_CHAT_REQ_LOGIN>;
+    wire.Body.AccountNo = AccountNo;
+    ::memcpy(wire.Body.ID, ID, sizeof(wire.Body.ID));
+    ::memcpy(wire.Body.Nickname, Nickname, sizeof(wire.Body.Nickname));
+    ::memcpy(wire.Body.SessionKey, SessionKey, sizeof(wire.Body.SessionKey));
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+// äü α 
+inline Serializer* Encode_CS_CHAT_RES_LOGIN(const uint8_t Status, const int64_t AccountNo)
+{
+    PacketWire<CS_CHAT_RES_LOGIN> wire;
+    wire.Type = PACKET_TYPE<CS_CHAT_RES_LOGIN>;
+    wire.Body.Status = Status;
+    wire.Body.AccountNo = AccountNo;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+// äü  ̵ û
+inline Serializer* Encode_CS_CHAT_REQ_SECTOR_MOVE(const int64_t AccountNo, const uint16_t SectorX, const uint16_t SectorY)
+{
+    PacketWire<CS_CHAT_REQ_SECTOR_MOVE> wire;
+    wire.Type = PACKET_TYPE<CS_CHAT_REQ_SECTOR_MOVE>;
+    wire.Body.AccountNo = AccountNo;
+    wire.Body.SectorX = SectorX;
+    wire.Body.SectorY = SectorY;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+// äü  ̵ 
+inline Serializer* Encode_CS_CHAT_RES_SECTOR_MOVE(const int64_t AccountNo, const uint16_t SectorX, const uint16_t SectorY)
+{
+    PacketWire<CS_CHAT_RES_SECTOR_MOVE> wire;
+    wire.Type = PACKET_TYPE<CS_CHAT_RES_SECTOR_MOVE>;
+    wire.Body.AccountNo = AccountNo;
+    wire.Body.SectorX = SectorX;
+    wire.Body.SectorY = SectorY;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+// äü äú û
+// Message  ġ MessageLen Ʈ  ־ Ѵ ( Ŷ  ״ ű)
+inline Serializer* Encode_CS_CHAT_REQ_MESSAGE(const int64_t AccountNo, const uint16_t MessageLen, Serializer* Message)
+{
+    PacketWire<CS_CHAT_REQ_MESSAGE> wire;
+    wire.Type = PACKET_TYPE<CS_CHAT_REQ_MESSAGE>;
+    wire.Body.AccountNo = AccountNo;
+    wire.Body.MessageLen = MessageLen;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire) + MessageLen);
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+    Message->GetByte(packet, MessageLen);
+
+    return packet;
+}
+
+// äü äú  (ٸ Ŭ  äõ ̰ɷ )
+// Message  ġ MessageLen Ʈ  ־ Ѵ ( Ŷ  ״ ű)
+inline Serializer* Encode_CS_CHAT_RES_MESSAGE(const int64_t AccountNo, const WCHAR16 ID[20], const WCHAR16 Nickname[20], const uint16_t MessageLen, Serializer* Message)
+{
+    PacketWire<CS_CHAT_RES_MESSAGE> wire;
+    wire.Type = PACKET_TYPE<CS_CHAT_RES_MESSAGE>;
+    wire.Body.AccountNo = AccountNo;
+    ::memcpy(wire.Body.ID, ID, sizeof(wire.Body.ID));
+    ::memcpy(wire.Body.Nickname, Nickname, sizeof(wire.Body.Nickname));
+    wire.Body.MessageLen = MessageLen;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire) + MessageLen);
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+    Message->GetByte(packet, MessageLen);
+
+    return packet;
+}
+
+// ƮƮ -  
+inline Serializer* Encode_CS_CHAT_REQ_HEARTBEAT(void)
+{
+    const uint16_t type = PACKET_TYPE<CS_CHAT_REQ_HEARTBEAT>;
+
+    Serializer* packet = Serializer::Alloc(sizeof(type));
+    packet->InsertByte(reinterpret_cast<const char*>(&type), sizeof(type));
+
+    return packet;
+}
+
+//  ͸  α
+inline Serializer* Encode_SS_MONITOR_LOGIN(const int32_t ServerNo)
+{
+    PacketWire<SS_MONITOR_LOGIN> wire;
+    wire.Type = PACKET_TYPE<SS_MONITOR_LOGIN>;
+    wire.Body.ServerNo = ServerNo;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+//  ͸    (1ʸ)
+inline Serializer* Encode_SS_MONITOR_DATA_UPDATE(const uint8_t DataType, const int32_t DataValue, const int32_t TimeStamp)
+{
+    PacketWire<SS_MONITOR_DATA_UPDATE> wire;
+    wire.Type = PACKET_TYPE<SS_MONITOR_DATA_UPDATE>;
+    wire.Body.DataType = DataType;
+    wire.Body.DataValue = DataValue;
+    wire.Body.TimeStamp = TimeStamp;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+// ͸  ͸  α û
+inline Serializer* Encode_CS_MONITOR_TOOL_REQ_LOGIN(const char LoginSessionKey[32])
+{
+    PacketWire<CS_MONITOR_TOOL_REQ_LOGIN> wire;
+    wire.Type = PACKET_TYPE<CS_MONITOR_TOOL_REQ_LOGIN>;
+    ::memcpy(wire.Body.LoginSessionKey, LoginSessionKey, sizeof(wire.Body.LoginSessionKey));
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+// ͸  α 
+inline Serializer* Encode_CS_MONITOR_TOOL_RES_LOGIN(const uint8_t Status)
+{
+    PacketWire<CS_MONITOR_TOOL_RES_LOGIN> wire;
+    wire.Type = PACKET_TYPE<CS_MONITOR_TOOL_RES_LOGIN>;
+    wire.Body.Status = Status;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+// ͸  ͸   
+inline Serializer* Encode_CS_MONITOR_TOOL_DATA_UPDATE(const uint8_t ServerNo, const uint8_t DataType, const int32_t DataValue, const int32_t TimeStamp)
+{
+    PacketWire<CS_MONITOR_TOOL_DATA_UPDATE> wire;
+    wire.Type = PACKET_TYPE<CS_MONITOR_TOOL_DATA_UPDATE>;
+    wire.Body.ServerNo = ServerNo;
+    wire.Body.DataType = DataType;
+    wire.Body.DataValue = DataValue;
+    wire.Body.TimeStamp = TimeStamp;
+
+    Serializer* packet = Serializer::Alloc(sizeof(wire));
+    packet->InsertByte(reinterpret_cast<const char*>(&wire), sizeof(wire));
+
+    return packet;
+}
+
+////////////////////////////////////////////////
+// ġ 
+////////////////////////////////////////////////
+
+// CHAT_SERVER ޴ ޼ - FIXED(޼) / VARIABLE(޼) ļ ġ ̺ 
+#define CHAT_SERVER_PACKET_HANDLERS(FIXED, VARIABLE) \
+    FIXED(CS_CHAT_REQ_LOGIN) \
+    FIXED(CS_CHAT_REQ_SECTOR_MOVE) \
+    VARIABLE(CS_CHAT_REQ_MESSAGE) \
+    FIXED(CS_CHAT_REQ_HEARTBEAT)
+
+// CHAT_SERVER ޴ ޼ Ÿ  (  ̻ Ÿ  ʴ´)
+inline constexpr uint32_t CHAT_SERVER_PACKET_TYPE_END = (std::max)({ PACKET_TYPE<CS_CHAT_REQ_LOGIN>, PACKET_TYPE<CS_CHAT_REQ_SECTOR_MOVE>, PACKET_TYPE<CS_CHAT_REQ_MESSAGE>, PACKET_TYPE<CS_CHAT_REQ_HEARTBEAT> }) + 1u;
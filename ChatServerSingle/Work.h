@@ -14,4 +14,5 @@ struct Work
     uint64_t SessionID;
     EWorkType WorkType;
     Serializer* Packet; // Accept, Release - nullptr
+    uint32_t EnqueueTick; // ť  ð (timeGetTime) - Ʈ   
 };
\ No newline at end of file
@@ -1,8 +1,14 @@
+#include <algorithm>
+
+#ifdef _WIN32
 #include <conio.h>
 #include <Windows.h>
 #include <process.h>
 #include <Psapi.h>
 #include <Pdh.h>
+#else
+#include "NetLibrary/Platform/LinuxCompat.h"
+#endif
 
 #include "NetLibrary/Tool/ConfigReader.h"
 #include "NetLibrary/Logger/Logger.h"
@@ -46,7 +52,7 @@ int main(void)
         ASSERT_LIVE(false, L"ERROR: invalid LOG_LEVEL");
     }
 
-    LOGF(ELogLevel::System, L"Logger Log Level = %s", inputLogLevel);
+    LOGF(ELogLevel::System, L"Logger Log Level = %ls", inputLogLevel);
 
     /*************************************** Config - NetServer ***************************************/
 
@@ -54,18 +60,102 @@ int main(void)
     uint32_t inputMaxSessionCount;
     uint32_t inputConcurrentThreadCount;
     uint32_t inputWorkerThreadCount;
+    uint32_t inputAcceptThreadCount;
+    uint32_t inputIoSharding;
     uint32_t inputSetTcpNodelay;
     uint32_t inputSetSendBufZero;
+    uint32_t inputMaxSendBufCount;
+    uint32_t inputSendCoalescingSize;
+    uint32_t inputDeferredSend;
+    uint32_t inputMaxSendQueueCount;
+    uint32_t inputMaxSendQueueBytes;
+    WCHAR inputSendOverflowPolicy[16];
+    uint32_t inputMaxConnectionsPerIp;
+    uint32_t inputMaxConnectsPerIpPerSec;
+    uint32_t inputMaxRecvPacketsPerSec;
+    uint32_t inputMaxRecvBytesPerSec;
+    SocketTuningProfile inputSocketTuningProfile{};
+    uint32_t inputSocketQuickAck;
 
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"PORT", &inputPortNumber), L"ERROR: config file read failed (PORT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_SESSION_COUNT", &inputMaxSessionCount), L"ERROR: config file read failed (MAX_SESSION_COUNT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"CONCURRENT_THREAD_COUNT", &inputConcurrentThreadCount), L"ERROR: config file read failed (CONCURRENT_THREAD_COUNT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"WORKER_THREAD_COUNT", &inputWorkerThreadCount), L"ERROR: config file read failed (WORKER_THREAD_COUNT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"ACCEPT_THREAD_COUNT", &inputAcceptThreadCount), L"ERROR: config file read failed (ACCEPT_THREAD_COUNT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"IO_SHARDING", &inputIoSharding), L"ERROR: config file read failed (IO_SHARDING)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"TCP_NODELAY", &inputSetTcpNodelay), L"ERROR: config file read failed (TCP_NODELAY)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SND_BUF_ZERO", &inputSetSendBufZero), L"ERROR: config file read failed (SND_BUF_ZERO)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_SEND_BUF_COUNT", &inputMaxSendBufCount), L"ERROR: config file read failed (MAX_SEND_BUF_COUNT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SEND_COALESCING_SIZE", &inputSendCoalescingSize), L"ERROR: config file read failed (SEND_COALESCING_SIZE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"DEFERRED_SEND", &inputDeferredSend), L"ERROR: config file read failed (DEFERRED_SEND)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_SEND_QUEUE_COUNT", &inputMaxSendQueueCount), L"ERROR: config file read failed (MAX_SEND_QUEUE_COUNT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_SEND_QUEUE_BYTES", &inputMaxSendQueueBytes), L"ERROR: config file read failed (MAX_SEND_QUEUE_BYTES)");
+    ASSERT_LIVE(ConfigReader::GetString(CONFIG_FILE_NAME, L"SEND_OVERFLOW_POLICY", inputSendOverflowPolicy, 16), L"ERROR: config file read failed (SEND_OVERFLOW_POLICY)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_CONNECTIONS_PER_IP", &inputMaxConnectionsPerIp), L"ERROR: config file read failed (MAX_CONNECTIONS_PER_IP)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_CONNECTS_PER_IP_PER_SEC", &inputMaxConnectsPerIpPerSec), L"ERROR: config file read failed (MAX_CONNECTS_PER_IP_PER_SEC)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_RECV_PACKETS_PER_SEC", &inputMaxRecvPacketsPerSec), L"ERROR: config file read failed (MAX_RECV_PACKETS_PER_SEC)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_RECV_BYTES_PER_SEC", &inputMaxRecvBytesPerSec), L"ERROR: config file read failed (MAX_RECV_BYTES_PER_SEC)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_RCVBUF", &inputSocketTuningProfile.RecvBufferSize), L"ERROR: config file read failed (SOCKET_RCVBUF)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_SNDBUF", &inputSocketTuningProfile.SendBufferSize), L"ERROR: config file read failed (SOCKET_SNDBUF)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_KEEPALIVE_IDLE", &inputSocketTuningProfile.KeepAliveIdleSec), L"ERROR: config file read failed (SOCKET_KEEPALIVE_IDLE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_KEEPALIVE_INTERVAL", &inputSocketTuningProfile.KeepAliveIntervalSec), L"ERROR: config file read failed (SOCKET_KEEPALIVE_INTERVAL)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_KEEPALIVE_PROBES", &inputSocketTuningProfile.KeepAliveProbeCount), L"ERROR: config file read failed (SOCKET_KEEPALIVE_PROBES)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_QUICKACK", &inputSocketQuickAck), L"ERROR: config file read failed (SOCKET_QUICKACK)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_NOTSENT_LOWAT", &inputSocketTuningProfile.NotSentLowat), L"ERROR: config file read failed (SOCKET_NOTSENT_LOWAT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SOCKET_BUSY_POLL_US", &inputSocketTuningProfile.BusyPollUs), L"ERROR: config file read failed (SOCKET_BUSY_POLL_US)");
+    inputSocketTuningProfile.bQuickAck = (inputSocketQuickAck != 0);
 
     LOGF(ELogLevel::System, L"CONCURRENT_THREAD_COUNT = %u", inputConcurrentThreadCount);
     LOGF(ELogLevel::System, L"WORKER_THREAD_COUNT = %u", inputWorkerThreadCount);
+    LOGF(ELogLevel::System, L"ACCEPT_THREAD_COUNT = %u", inputAcceptThreadCount);
+    LOGF(ELogLevel::System, L"MAX_SEND_BUF_COUNT = %u", inputMaxSendBufCount);
+    LOGF(ELogLevel::System, L"SEND_COALESCING_SIZE = %u", inputSendCoalescingSize);
+    LOGF(ELogLevel::System, L"MAX_SEND_QUEUE_COUNT = %u", inputMaxSendQueueCount);
+    LOGF(ELogLevel::System, L"MAX_SEND_QUEUE_BYTES = %u", inputMaxSendQueueBytes);
+    LOGF(ELogLevel::System, L"SEND_OVERFLOW_POLICY = %ls", inputSendOverflowPolicy);
+    LOGF(ELogLevel::System, L"MAX_CONNECTIONS_PER_IP = %u", inputMaxConnectionsPerIp);
+    LOGF(ELogLevel::System, L"MAX_CONNECTS_PER_IP_PER_SEC = %u", inputMaxConnectsPerIpPerSec);
+    LOGF(ELogLevel::System, L"MAX_RECV_PACKETS_PER_SEC = %u", inputMaxRecvPacketsPerSec);
+    LOGF(ELogLevel::System, L"MAX_RECV_BYTES_PER_SEC = %u", inputMaxRecvBytesPerSec);
+    LOGF(ELogLevel::System, L"SOCKET_RCVBUF = %u, SOCKET_SNDBUF = %u", inputSocketTuningProfile.RecvBufferSize, inputSocketTuningProfile.SendBufferSize);
+    LOGF(ELogLevel::System, L"SOCKET_KEEPALIVE_IDLE = %u, SOCKET_KEEPALIVE_INTERVAL = %u, SOCKET_KEEPALIVE_PROBES = %u",
+        inputSocketTuningProfile.KeepAliveIdleSec, inputSocketTuningProfile.KeepAliveIntervalSec, inputSocketTuningProfile.KeepAliveProbeCount);
+    LOGF(ELogLevel::System, L"SOCKET_QUICKACK = %u, SOCKET_NOTSENT_LOWAT = %u, SOCKET_BUSY_POLL_US = %u",
+        inputSocketQuickAck, inputSocketTuningProfile.NotSentLowat, inputSocketTuningProfile.BusyPollUs);
+
+    myChatServer.SetAcceptThreadCount(inputAcceptThreadCount);
+    myChatServer.SetMaxSendBufferCount(inputMaxSendBufCount);
+    myChatServer.SetSendCoalescingSize(inputSendCoalescingSize);
+    myChatServer.SetMaxSendQueueCount(inputMaxSendQueueCount);
+    myChatServer.SetMaxSendQueueBytes(inputMaxSendQueueBytes);
+    myChatServer.SetMaxConnectionsPerIp(inputMaxConnectionsPerIp);
+    myChatServer.SetMaxConnectsPerIpPerSecond(inputMaxConnectsPerIpPerSec);
+    myChatServer.SetMaxRecvPacketsPerSecond(inputMaxRecvPacketsPerSec);
+    myChatServer.SetMaxRecvBytesPerSecond(inputMaxRecvBytesPerSec);
+    myChatServer.SetSocketTuningProfile(inputSocketTuningProfile);
+
+    if (wcscmp(inputSendOverflowPolicy, L"DROP_NEWEST") == 0)
+    {
+        myChatServer.SetSendOverflowPolicy(ESendOverflowPolicy::DropNewest);
+    }
+    else if (wcscmp(inputSendOverflowPolicy, L"DROP_OLDEST") == 0)
+    {
+        myChatServer.SetSendOverflowPolicy(ESendOverflowPolicy::DropOldest);
+    }
+    else if (wcscmp(inputSendOverflowPolicy, L"DISCONNECT") == 0)
+    {
+        myChatServer.SetSendOverflowPolicy(ESendOverflowPolicy::Disconnect);
+    }
+    else
+    {
+        ASSERT_LIVE(false, L"ERROR: invalid SEND_OVERFLOW_POLICY");
+    }
+
+    if (inputIoSharding != 0)
+    {
+        myChatServer.SetIoSharding(true);
+        LOGF(ELogLevel::System, L"ChatServer - SetIoSharding(true)");
+    }
 
     if (inputSetTcpNodelay != 0)
     {
@@ -79,25 +169,48 @@ int main(void)
         LOGF(ELogLevel::System, L"ChatServer - SetSendBufferSizeToZero(true)");
     }
 
+    if (inputDeferredSend != 0)
+    {
+        myChatServer.SetDeferredSend(true);
+        LOGF(ELogLevel::System, L"ChatServer - SetDeferredSend(true)");
+    }
+
     /*************************************** Config - ChatServer ***************************************/
 
     uint32_t inputTimeoutCheckInterval;
     uint32_t inputTimeoutLoggedIn;
     uint32_t inputTimeoutNotLoggedIn;
     uint32_t inputUseRedis; // α    ϴ  (׽Ʈ)
+    uint32_t inputOverloadDropChatQueueSize;
+    uint32_t inputOverloadDropChatLag;
+    uint32_t inputOverloadRejectLoginQueueSize;
+    uint32_t inputOverloadRejectLoginLag;
+    uint32_t inputOverloadPauseAcceptQueueSize;
+    uint32_t inputOverloadPauseAcceptLag;
 
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"TIMEOUT_CHECK_INTERVAL", &inputTimeoutCheckInterval), L"ERROR: config file read failed (TIMEOUT_CHECK_INTERVAL)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"TIMEOUT_LOGGED_IN", &inputTimeoutLoggedIn), L"ERROR: config file read failed (TIMEOUT_LOGGED_IN)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"TIMEOUT_NOT_LOGGED_IN", &inputTimeoutNotLoggedIn), L"ERROR: config file read failed (TIMEOUT_NOT_LOGGED_IN)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"USE_REDIS", &inputUseRedis), L"ERROR: config file read failed (USE_REDIS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"OVERLOAD_DROP_CHAT_QUEUE_SIZE", &inputOverloadDropChatQueueSize), L"ERROR: config file read failed (OVERLOAD_DROP_CHAT_QUEUE_SIZE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"OVERLOAD_DROP_CHAT_LAG", &inputOverloadDropChatLag), L"ERROR: config file read failed (OVERLOAD_DROP_CHAT_LAG)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"OVERLOAD_REJECT_LOGIN_QUEUE_SIZE", &inputOverloadRejectLoginQueueSize), L"ERROR: config file read failed (OVERLOAD_REJECT_LOGIN_QUEUE_SIZE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"OVERLOAD_REJECT_LOGIN_LAG", &inputOverloadRejectLoginLag), L"ERROR: config file read failed (OVERLOAD_REJECT_LOGIN_LAG)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"OVERLOAD_PAUSE_ACCEPT_QUEUE_SIZE", &inputOverloadPauseAcceptQueueSize), L"ERROR: config file read failed (OVERLOAD_PAUSE_ACCEPT_QUEUE_SIZE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"OVERLOAD_PAUSE_ACCEPT_LAG", &inputOverloadPauseAcceptLag), L"ERROR: config file read failed (OVERLOAD_PAUSE_ACCEPT_LAG)");
 
     myChatServer.SetTimeoutCheckInterval(inputTimeoutCheckInterval);
     myChatServer.SetTimeoutLoggedIn(inputTimeoutLoggedIn);
     myChatServer.SetTimeoutNotLoggedIn(inputTimeoutNotLoggedIn);
+    myChatServer.SetOverloadWatermark(EOverloadLevel::DropChat, inputOverloadDropChatQueueSize, inputOverloadDropChatLag);
+    myChatServer.SetOverloadWatermark(EOverloadLevel::RejectLogin, inputOverloadRejectLoginQueueSize, inputOverloadRejectLoginLag);
+    myChatServer.SetOverloadWatermark(EOverloadLevel::PauseAccept, inputOverloadPauseAcceptQueueSize, inputOverloadPauseAcceptLag);
 
     LOGF(ELogLevel::System, L"TIMEOUT_CHECK_INTERVAL = %u", inputTimeoutCheckInterval);
     LOGF(ELogLevel::System, L"TIMEOUT_LOGGED_IN = %u", inputTimeoutLoggedIn);
     LOGF(ELogLevel::System, L"TIMEOUT_NOT_LOGGED_IN = %u", inputTimeoutNotLoggedIn);
+    LOGF(ELogLevel::System, L"OVERLOAD DROP_CHAT = %u / %ums, REJECT_LOGIN = %u / %ums, PAUSE_ACCEPT = %u / %ums",
+        inputOverloadDropChatQueueSize, inputOverloadDropChatLag, inputOverloadRejectLoginQueueSize, inputOverloadRejectLoginLag, inputOverloadPauseAcceptQueueSize, inputOverloadPauseAcceptLag);
 
     if (inputUseRedis != 0)
     {
@@ -126,6 +239,7 @@ int main(void)
 
 #pragma endregion
 
+#ifdef _WIN32
 #pragma region ͸    PDH  ۾
 
     WCHAR processName[MAX_PATH];
@@ -148,14 +262,16 @@ int main(void)
     PdhCollectQueryData(queryHandle);
 
 #pragma endregion
+#endif
 
-    // ִ ̷ε  
-    myChatServer.SetMaxPayloadLength(1'000);
+    // ִ ̷ε   (ȭ  ù ۺ ũ ׸Ʈ ̾,    8KB ȿ  Բ  Ѵ)
+    myChatServer.SetMaxPayloadLength(4'000);
 
     //  
     myChatServer.Start(static_cast<uint16_t>(inputPortNumber), inputMaxSessionCount, inputConcurrentThreadCount, inputWorkerThreadCount);
 
     MonitoringVariables monitoringInfo;                             // NetServer ͸ 
+    Serializer::PacketPoolInfo packetPoolInfos[static_cast<uint32_t>(Serializer::ESizeClass::Count)]; // ũ ޺ Ŷ Ǯ 
     std::vector<ChatServer::SectorMonitorInfo> sectorMonitorInfos;  // ä   ͸ 
 
     HANDLE mainThreadTimer = ::CreateWaitableTimer(NULL, FALSE, NULL);
@@ -198,9 +314,34 @@ int main(void)
         }
 
         // Pdh - private bytes
+#ifdef _WIN32
         PdhCollectQueryData(queryHandle);
         PDH_FMT_COUNTERVALUE privateBytesValue;
         PdhGetFormattedCounterValue(privateBytes, PDH_FMT_LARGE, NULL, &privateBytesValue);
+        int64_t privateByteSize = privateBytesValue.largeValue;
+#else
+        // Linux - /proc/self/statm (resident - shared) 
+        int64_t privateByteSize = 0;
+        FILE* statmFile = ::fopen("/proc/self/statm", "r");
+        if (statmFile != nullptr)
+        {
+            long long totalPages, residentPages, sharedPages;
+            if (::fscanf(statmFile, "%lld %lld %lld", &totalPages, &residentPages, &sharedPages) == 3)
+            {
+                privateByteSize = (residentPages - sharedPages) * ::sysconf(_SC_PAGESIZE);
+            }
+            ::fclose(statmFile);
+        }
+#endif
+
+        // Ŷ Ǯ - ũ ޺
+        uint32_t totalPacketCount = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(Serializer::ESizeClass::Count); ++i)
+        {
+            packetPoolInfos[i] = Serializer::GetPacketPoolInfo(static_cast<Serializer::ESizeClass>(i));
+            totalPacketCount += packetPoolInfos[i].CreatedCount;
+        }
+        Serializer::PacketPoolInfo segmentPoolInfo = Serializer::GetSegmentPoolInfo();
 
         // ͸  ͸  
         if (monitorClient.IsConnected())
@@ -208,11 +349,11 @@ int main(void)
             int32_t timeStamp = static_cast<int32_t>(time(nullptr));
             monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_SERVER_RUN, 1, timeStamp);
             monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_SERVER_CPU, static_cast<int32_t>(monitoringInfo.ProcessTimeTotal), timeStamp);
-            monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_SERVER_MEM, static_cast<int32_t>(privateBytesValue.largeValue / 1'000'000), timeStamp);
+            monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_SERVER_MEM, static_cast<int32_t>(privateByteSize / 1'000'000), timeStamp);
             monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_SESSION, myChatServer.GetSessionCount(), timeStamp);
             monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_PLAYER, static_cast<int32_t>(myChatServer.GetRealPlayerCount()), timeStamp);
             monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_UPDATE_TPS, static_cast<int32_t>(processedMessageCountPerSecond), timeStamp);
-            monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_PACKET_POOL, Serializer::GetTotalPacketCount(), timeStamp);
+            monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_PACKET_POOL, static_cast<int32_t>(totalPacketCount), timeStamp);
             monitorClient.Send_MONITOR_DATA_UPDATE(en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_CHAT_UPDATEMSG_POOL, static_cast<int32_t>(minWorkQueueSizePerSecond), timeStamp);
         }
 
@@ -241,24 +382,44 @@ int main(void)
         //LOG_CURRENT_TIME();
         wprintf(L"[ ChatServer Running (S: profile save) (Q: quit)]\n");
         wprintf(L"=================================================\n");
-        wprintf(L"Session Count        = %u / %u\n", myChatServer.GetSessionCount(), myChatServer.GetMaxSessionCount());
+        wprintf(L"Session Count        = %u / %u (Allocated: %u)\n", myChatServer.GetSessionCount(), myChatServer.GetMaxSessionCount(), myChatServer.GetSessionTableCapacity());
         wprintf(L"Accept Total         = %llu\n", myChatServer.GetTotalAcceptCount());
         wprintf(L"Disconnected Total   = %llu\n", myChatServer.GetTotalDisconnectCount());
-        wprintf(L"Packet Pool Size     = %u\n", Serializer::GetTotalPacketCount());
+        for (const Serializer::PacketPoolInfo& info : packetPoolInfos)
+        {
+            wprintf(L"Packet Pool %5uB   = %u / %u (Held / Created)\n", info.BufferSize, info.HeldCount, info.CreatedCount);
+        }
+        wprintf(L"Packet Segment Pool  = %u / %u (Held / Created)\n", segmentPoolInfo.HeldCount, segmentPoolInfo.CreatedCount);
+        wprintf(L"Recv Buffer Pool     = %u / %u\n", myChatServer.GetRecvBufferUseCount(), myChatServer.GetRecvBufferPoolCapacity());
         wprintf(L"---------------------- TPS ----------------------\n");
         wprintf(L"Accept TPS           = %9u (Avg: %9u)\n", monitoringInfo.AcceptTPS, monitoringInfo.AverageAcceptTPS);
         wprintf(L"Send Message TPS     = %9u (Avg: %9u)\n", monitoringInfo.SendMessageTPS, monitoringInfo.AverageSendMessageTPS);
         wprintf(L"Recv Message TPS     = %9u (Avg: %9u)\n", monitoringInfo.RecvMessageTPS, monitoringInfo.AverageRecvMessageTPS);
         wprintf(L"Send Pending TPS     = %9u (Avg: %9u)\n", monitoringInfo.SendPendingTPS, monitoringInfo.AverageSendPendingTPS);
         wprintf(L"Recv Pending TPS     = %9u (Avg: %9u)\n", monitoringInfo.RecvPendingTPS, monitoringInfo.AverageRecvPendingTPS);
-        wprintf(L"----------------------- CPU ---------------------\n");
+        wprintf(L"Send Call TPS        = %9u (Avg: %9u)\n", monitoringInfo.SendCallTPS, monitoringInfo.AverageSendCallTPS);
+        wprintf(L"Send Bytes / Call    = %9u (Avg: %9u)\n",
+            monitoringInfo.SendCallTPS > 0 ? monitoringInfo.SendBytesTPS / monitoringInfo.SendCallTPS : 0,
+            monitoringInfo.AverageSendCallTPS > 0 ? monitoringInfo.AverageSendBytesTPS / monitoringInfo.AverageSendCallTPS : 0);
+        wprintf(L"Send Overflow        = Drop New: %u / Drop Old: %u / Disconnect: %u\n",
+        monitoringInfo.SendDropNewestTPS, monitoringInfo.SendDropOldestTPS, monitoringInfo.SendOverflowDisconnectTPS);
+        wprintf(L"Rate Limit           = IP Conn: %u / IP Connect Rate: %u / Recv Rate: %u\n",
+        monitoringInfo.IpConnectionRejectTPS, monitoringInfo.IpConnectRateRejectTPS, monitoringInfo.RecvRateViolationTPS);
+    wprintf(L"----------------------- CPU ---------------------\n");
         wprintf(L"Total  = Processor: %6.3f / Process: %6.3f\n", monitoringInfo.ProcessorTimeTotal, monitoringInfo.ProcessTimeTotal);
         wprintf(L"User   = Processor: %6.3f / Process: %6.3f\n", monitoringInfo.ProcessorTimeUser, monitoringInfo.ProcessTimeUser);
         wprintf(L"Kernel = Processor: %6.3f / Process: %6.3f\n", monitoringInfo.ProcessorTimeKernel, monitoringInfo.ProcessTimeKernel);
         wprintf(L"=================================================\n");
         wprintf(L"WorkQueue Size Max = %5u (Total Max: %5u)\n", maxWorkQueueSizePerSecond, myChatServer.GetTotalMaxWorkQueueSize());
         wprintf(L"WorkQueue Size Min = %5u\n", minWorkQueueSizePerSecond);
-        wprintf(L"Processed Message  = %5u\n\n", processedMessageCountPerSecond);
+        wprintf(L"Processed Message  = %5u\n", processedMessageCountPerSecond);
+        wprintf(L"Overload Level     = %5d (Dropped Chat: %llu / Rejected Login: %llu)\n",
+            static_cast<int>(myChatServer.GetOverloadLevel()), myChatServer.GetOverloadDroppedChatCount(), myChatServer.GetOverloadRejectedLoginCount());
+        wprintf(L"Overload Time (s)  = Normal: %llu / DropChat: %llu / RejectLogin: %llu / PauseAccept: %llu\n\n",
+            myChatServer.GetOverloadLevelTime(EOverloadLevel::Normal) / 1'000,
+            myChatServer.GetOverloadLevelTime(EOverloadLevel::DropChat) / 1'000,
+            myChatServer.GetOverloadLevelTime(EOverloadLevel::RejectLogin) / 1'000,
+            myChatServer.GetOverloadLevelTime(EOverloadLevel::PauseAccept) / 1'000);
 
         wprintf(L"[Player & Sector]\n");
         wprintf(L"Player Count     = %5u / %5u\n", myChatServer.GetRealPlayerCount(), myChatServer.GetPlayerPoolSize());